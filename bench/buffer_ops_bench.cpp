@@ -0,0 +1,145 @@
+// Times the word kernels of buffer_ops.hpp against the byte loops they replace, and every
+// kernel on each backend the CPU supports.
+//
+//   cmake -S . -B build-host -DPICO_OLED_HOST=ON && cmake --build build-host
+//   ./build-host/pico-oled-bench
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+
+#include "buffer_ops.hpp"
+#include "imbuf.hpp"
+#include "types.hpp"
+
+using namespace pico_oled;
+
+namespace {
+
+constexpr u32 k_rounds = 200'000;
+constexpr u16 k_width_byte = k_width / 8;
+
+/// Keeps the compiler from dropping or merging the rounds
+auto clobber(ImBuf &buf) -> void { asm volatile("" : : "r"(buf.data()) : "memory"); }
+
+/// Nanoseconds per call of `op`
+template <typename Op>
+auto time_ns(ImBuf &buf, Op op) -> double {
+    const auto start = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < k_rounds; i++) {
+        op();
+        clobber(buf);
+    }
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / k_rounds;
+}
+
+template <typename Bytes, typename Words>
+auto compare(const char *name, ImBuf &buf, Bytes bytes, Words words) -> void {
+    const double byte_ns = time_ns(buf, bytes);
+    const double word_ns = time_ns(buf, words);
+    std::printf("%-8s %9.1f ns %9.1f ns %6.2fx\n", name, byte_ns, word_ns, byte_ns / word_ns);
+}
+
+constexpr std::array<buffer::eKernelBackend, 3> k_backends = {
+    buffer::eKernelBackend::SCALAR, buffer::eKernelBackend::SSE2, buffer::eKernelBackend::AVX2};
+
+/// One row of the backend table, "-" for backends the CPU lacks
+template <typename Op>
+auto compare_backends(const char *name, ImBuf &buf, Op op) -> void {
+    std::printf("%-10s", name);
+    for (const buffer::eKernelBackend backend : k_backends) {
+        if (buffer::use_backend(backend)) {
+            std::printf(" %9.1f ns", time_ns(buf, op));
+        } else {
+            std::printf(" %12s", "-");
+        }
+    }
+    std::printf("\n");
+}
+
+}  // namespace
+
+auto main() -> int {
+    static ImBuf dst;
+    static ImBuf src;
+    for (u32 i = 0; i < k_imsize; i++) src[i] = static_cast<u8>(i * 37);
+
+    // The word kernels are what the Pico runs
+    buffer::use_backend(buffer::eKernelBackend::SCALAR);
+    std::printf("%-8s %12s %12s %7s\n", "kernel", "bytes", "words", "speedup");
+
+    // The loop `Paint::clear_color` used, with the address computed per byte
+    compare(
+        "fill",
+        dst,
+        [] {
+            for (u16 Y = 0; Y < k_height; Y++) {
+                for (u16 X = 0; X < k_width_byte; X++) dst[X + Y * k_width_byte] = 0xFF;
+            }
+        },
+        [] { buffer::fill(dst, 0xFF); });
+    compare(
+        "invert",
+        dst,
+        [] {
+            for (u32 i = 0; i < k_imsize; i++) dst[i] = static_cast<u8>(~dst[i]);
+        },
+        [] { buffer::invert(dst); });
+    compare(
+        "copy",
+        dst,
+        [] {
+            for (u32 i = 0; i < k_imsize; i++) dst[i] = src[i];
+        },
+        [] { buffer::copy(dst, src); });
+    compare(
+        "and",
+        dst,
+        [] {
+            for (u32 i = 0; i < k_imsize; i++) dst[i] = static_cast<u8>(dst[i] & src[i]);
+        },
+        [] { buffer::and_with(dst, src); });
+    compare(
+        "or",
+        dst,
+        [] {
+            for (u32 i = 0; i < k_imsize; i++) dst[i] = static_cast<u8>(dst[i] | src[i]);
+        },
+        [] { buffer::or_with(dst, src); });
+    compare(
+        "xor",
+        dst,
+        [] {
+            for (u32 i = 0; i < k_imsize; i++) dst[i] = static_cast<u8>(dst[i] ^ src[i]);
+        },
+        [] { buffer::xor_with(dst, src); });
+
+    // A gray image of the panel, and the panel turned on its side
+    static std::array<u8, k_width * k_height> gray;
+    for (u32 i = 0; i < gray.size(); i++) gray[i] = static_cast<u8>(i * 7);
+    static ImBuf mask;
+    for (u32 i = 0; i < k_imsize; i++) mask[i] = static_cast<u8>(i * 13);
+    static ImBuf turned;
+
+    std::printf("\n%-10s %12s %12s %12s\n", "kernel", "scalar", "sse2", "avx2");
+    compare_backends("fill", dst, [] { buffer::fill(dst, 0xFF); });
+    compare_backends("invert", dst, [] { buffer::invert(dst); });
+    compare_backends("copy", dst, [] { buffer::copy(dst, src); });
+    compare_backends("xor", dst, [] { buffer::xor_with(dst, src); });
+    compare_backends("blend", dst, [] { buffer::blend(dst, src, mask); });
+    compare_backends("transpose", turned, [] {
+        buffer::transpose(src.data(), k_width / 8, turned.data(), k_height / 8, k_width, k_height);
+    });
+    compare_backends("flip", dst, [] { buffer::flip_horizontal(dst); });
+    compare_backends("rotate90", turned, [] { buffer::rotate_90(turned, src); });
+    compare_backends("dither", dst, [] {
+        buffer::dither(gray.data(), k_width, dst.data(), k_width / 8, k_width, k_height);
+    });
+    compare_backends("diff", dst, [] {
+        const Rect changed = buffer::diff(dst, src);
+        asm volatile("" : : "r"(&changed) : "memory");
+    });
+    return 0;
+}
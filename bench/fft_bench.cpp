@@ -0,0 +1,118 @@
+// Times the Q15 FFT of fft_q15.hpp and a whole spectrum frame, and estimates what they cost on
+// the Cortex-M0+ of the Pico.
+//
+//   cmake -S . -B build-host -DPICO_OLED_HOST=ON && cmake --build build-host
+//   ./build-host/pico-oled-fft-bench
+
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cstdio>
+#include <span>
+
+#include "dirty_rects.hpp"
+#include "fft_q15.hpp"
+#include "imbuf.hpp"
+#include "paint.hpp"
+#include "spectrum_bars.hpp"
+#include "types.hpp"
+
+using namespace pico_oled;
+
+namespace {
+
+constexpr u32 k_rounds = 20'000;
+
+/// Clock of the RP2040 at the SDK default
+constexpr double k_pico_hz = 125e6;
+
+/// Cycles of one butterfly on the M0+, counted from its instruction timings: four halfword
+/// loads and four stores at 2 cycles, four single cycle multiplies and about eighteen cycles of
+/// adds, shifts and loop overhead
+constexpr u32 k_butterfly_cycles = 38;
+
+/// Cycles per point of the bit reversal, the window and the magnitudes together
+constexpr u32 k_point_cycles = 60;
+
+/// Keeps the compiler from dropping or merging the rounds
+auto clobber(const void *data) -> void { asm volatile("" : : "r"(data) : "memory"); }
+
+/// Nanoseconds per call of `op`
+template <typename Op>
+auto time_ns(const void *data, Op op) -> double {
+    const auto start = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < k_rounds; i++) {
+        op();
+        clobber(data);
+    }
+    const std::chrono::duration<double, std::nano> elapsed =
+        std::chrono::steady_clock::now() - start;
+    return elapsed.count() / k_rounds;
+}
+
+/// A few tones over some noise, as a microphone would give them
+auto make_signal(std::array<i16, dsp::k_fft_max_points> &samples) -> void {
+    u32 noise = 1;
+    for (u32 i = 0; i < samples.size(); i++) {
+        noise = noise * 1'103'515'245u + 12'345u;
+        const i32 tones = dsp::k_twiddles[(i * 5) % dsp::k_twiddles.size()] / 3 +
+                          dsp::k_twiddles[(i * 37) % dsp::k_twiddles.size()] / 4;
+        samples[i] = static_cast<i16>(tones + static_cast<i32>(noise >> 22) - 512);
+    }
+}
+
+}  // namespace
+
+auto main() -> int {
+    static std::array<i16, dsp::k_fft_max_points> samples;
+    static std::array<i16, dsp::k_fft_max_points> real;
+    static std::array<i16, dsp::k_fft_max_points> imag;
+    static std::array<u16, dsp::k_fft_max_points / 2> magnitudes;
+    make_signal(samples);
+
+    std::printf("%-8s %10s %12s %10s\n", "points", "host", "m0+ cycles", "m0+ time");
+    for (u16 points = 16; points <= dsp::k_fft_max_points; points <<= 1) {
+        const double ns = time_ns(real.data(), [points] {
+            real = samples;
+            imag = {};
+            dsp::apply_hann(std::span(real.data(), points));
+            dsp::fft(std::span(real.data(), points), std::span(imag.data(), points));
+            dsp::magnitudes(real, imag, std::span(magnitudes.data(), points / 2));
+        });
+
+        // N/2 butterflies in each of log2(N) stages
+        const u32 stages = static_cast<u32>(std::countr_zero(points));
+        const u32 cycles = points / 2 * stages * k_butterfly_cycles + points * k_point_cycles;
+        std::printf("%-8u %7.0f ns %12u %7.2f ms\n",
+                    static_cast<unsigned>(points),
+                    ns,
+                    static_cast<unsigned>(cycles),
+                    cycles / k_pico_hz * 1e3);
+    }
+
+    // A whole frame: analysis, the bars that changed, and the rectangles they dirtied
+    static paint::Paint paint;
+    paint.create_image(k_width, k_height, paint::eRotation::eROTATE_0, paint::eImageColors::WHITE);
+    paint.clear_color(paint::eImageColors::BLACK);
+    paint::SpectrumBars bars({0, 0, k_width - 1, k_height - 1},
+                             32,
+                             dsp::k_fft_max_points,
+                             paint::eImageColors::WHITE,
+                             paint::eImageColors::BLACK);
+    u32 frame = 0;
+    const double frame_ns = time_ns(&paint, [&] {
+        // Moves the tones a little every frame, so the bars keep changing
+        samples[frame++ % samples.size()] ^= 0x0400;
+        DirtyRects dirty;
+        bars.update(samples);
+        bars.draw(paint, dirty);
+    });
+    const u32 fft_cycles = dsp::k_fft_max_points / 2 *
+                               std::countr_zero(dsp::k_fft_max_points) * k_butterfly_cycles +
+                           dsp::k_fft_max_points * k_point_cycles;
+    std::printf("\nspectrum frame %.0f ns on the host, the 256 point FFT takes %.1f%% of a "
+                "30 FPS frame on the m0+\n",
+                frame_ns,
+                fft_cycles / k_pico_hz * 30 * 100);
+    return 0;
+}
@@ -0,0 +1,58 @@
+# pico_oled_font_subset(<target> NAME <variable> FONT <font source>
+#                       [CHARS <characters>] [SCAN <sources>...])
+#
+# Packs the glyphs of FONT that are listed in CHARS or appear in a string literal of one of the
+# SCAN sources into a subset font, and compiles it into <target>. The generated header
+# <variable>.hpp declares `pico_oled::font::<variable>`, a PackedFont to draw with. A character
+# without a glyph in FONT fails the build.
+#
+#   pico_oled_font_subset(test NAME Clock24 FONT src/font24.cpp CHARS "0123456789:")
+#   pico_oled_font_subset(test NAME Ui12 FONT src/font12.cpp SCAN examples/test.cpp)
+function(pico_oled_font_subset target)
+    cmake_parse_arguments(PARSE_ARGV 1 SUBSET "" "NAME;FONT;CHARS" "SCAN")
+    if(NOT PICO_OLED_PACKED_FONTS)
+        message(FATAL_ERROR "pico_oled_font_subset(${target}) needs PICO_OLED_PACKED_FONTS=ON")
+    endif()
+    if(NOT SUBSET_NAME OR NOT SUBSET_FONT)
+        message(FATAL_ERROR "pico_oled_font_subset(${target}) needs NAME and FONT")
+    endif()
+    if(NOT DEFINED SUBSET_CHARS AND NOT SUBSET_SCAN)
+        message(FATAL_ERROR "pico_oled_font_subset(${SUBSET_NAME}) needs CHARS or SCAN")
+    endif()
+
+    find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+    # Relative to this file, so the function also works when called from another project
+    set(pack_font ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../tools/pack_font.py)
+    set(headers ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/../includes/pico-oled)
+
+    get_filename_component(font ${SUBSET_FONT} ABSOLUTE)
+    set(out_dir ${CMAKE_CURRENT_BINARY_DIR}/pico-oled-fonts)
+    set(source ${out_dir}/${SUBSET_NAME}.cpp)
+    set(header ${out_dir}/${SUBSET_NAME}.hpp)
+
+    set(args)
+    set(scanned)
+    if(DEFINED SUBSET_CHARS)
+        list(APPEND args --chars ${SUBSET_CHARS})
+    endif()
+    foreach(file IN LISTS SUBSET_SCAN)
+        get_filename_component(file ${file} ABSOLUTE)
+        list(APPEND args --scan ${file})
+        list(APPEND scanned ${file})
+    endforeach()
+
+    file(MAKE_DIRECTORY ${out_dir})
+    add_custom_command(
+        OUTPUT ${source} ${header}
+        COMMAND Python3::Interpreter ${pack_font} ${font}
+                --name ${SUBSET_NAME} -o ${source} --header ${header} ${args}
+        DEPENDS ${pack_font} ${font} ${scanned}
+        COMMENT "Packing font subset ${SUBSET_NAME}"
+        VERBATIM
+    )
+
+    target_sources(${target} PRIVATE ${source} ${header})
+    # The generated files include the library headers by their bare names
+    target_include_directories(${target} PRIVATE ${out_dir} ${headers})
+endfunction()
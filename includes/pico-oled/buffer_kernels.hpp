@@ -0,0 +1,95 @@
+#ifndef __PICO_OLED_BUFFER_KERNELS_HPP
+#define __PICO_OLED_BUFFER_KERNELS_HPP
+
+#include <array>
+#include <bit>
+
+#include "imbuf.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+/// Backend side of `buffer_ops.hpp`: one table of kernels per instruction set
+///
+/// The kernels take raw pointers with `Bytes` already limited to the buffer. Buffer pointers
+/// are word aligned, as `ImBuf` is.
+namespace pico_oled::buffer {
+
+struct Kernels {
+    void (*fill)(u8 *dst, u8 Value, u32 Bytes);
+    void (*invert)(u8 *dst, u32 Bytes);
+    void (*copy)(u8 *dst, const u8 *src, u32 Bytes);
+    void (*and_with)(u8 *dst, const u8 *src, u32 Bytes);
+    void (*or_with)(u8 *dst, const u8 *src, u32 Bytes);
+    void (*xor_with)(u8 *dst, const u8 *src, u32 Bytes);
+    void (*blend)(u8 *dst, const u8 *src, const u8 *mask, u32 Bytes);
+    void (*transpose)(
+        const u8 *src, u32 src_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height);
+    void (*dither)(
+        const u8 *gray, u32 gray_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height);
+    Rect (*diff)(const u8 *prev, const u8 *next);
+};
+
+extern const Kernels k_scalar_kernels;
+#ifdef PICO_OLED_X86_KERNELS
+extern const Kernels k_sse2_kernels;
+extern const Kernels k_avx2_kernels;
+#endif
+
+/// Bytes of a buffer row, the diff kernels handle one 16 byte vector per row
+constexpr u32 k_row_bytes = k_width / 8;
+static_assert(k_row_bytes == 16, "the diff kernels expect 16 byte rows");
+
+/// Thresholds of the 8x8 Bayer matrix, a gray value above one lights its pixel
+constexpr auto make_dither_thresholds() -> std::array<std::array<u8, 8>, 8> {
+    constexpr u8 bayer[8][8] = {
+        {0, 32, 8, 40, 2, 34, 10, 42},
+        {48, 16, 56, 24, 50, 18, 58, 26},
+        {12, 44, 4, 36, 14, 46, 6, 38},
+        {60, 28, 52, 20, 62, 30, 54, 22},
+        {3, 35, 11, 43, 1, 33, 9, 41},
+        {51, 19, 59, 27, 49, 17, 57, 25},
+        {15, 47, 7, 39, 13, 45, 5, 37},
+        {63, 31, 55, 23, 61, 29, 53, 21},
+    };
+    std::array<std::array<u8, 8>, 8> thresholds = {};
+    for (u32 y = 0; y < 8; y++) {
+        // Centered in the step of each level, so 128 lights half the pixels
+        for (u32 x = 0; x < 8; x++) thresholds[y][x] = static_cast<u8>(bayer[y][x] * 4 + 2);
+    }
+    return thresholds;
+}
+
+constexpr auto k_dither_thresholds = make_dither_thresholds();
+
+/// Mirrors the bit order within each byte of a word, vector compares give the leftmost pixel
+/// in the lowest bit
+constexpr auto reverse_in_bytes(u32 v) -> u32 {
+    v = (v >> 1 & 0x55555555u) | (v & 0x55555555u) << 1;
+    v = (v >> 2 & 0x33333333u) | (v & 0x33333333u) << 2;
+    return (v >> 4 & 0x0F0F0F0Fu) | (v & 0x0F0F0F0Fu) << 4;
+}
+
+/// Mirrors the bit order of a word
+constexpr auto reverse_bits(u32 v) -> u32 {
+    v = reverse_in_bytes(v);
+    v = (v >> 8 & 0x00FF00FFu) | (v & 0x00FF00FFu) << 8;
+    return v >> 16 | v << 16;
+}
+
+/// Rectangle of a diff from the changed rows and the OR of all changed bits per row byte
+constexpr auto diff_bounds(const u8 *columns, i32 First_row, i32 Last_row) -> Rect {
+    if (First_row > Last_row) return {0, 0, -1, -1};
+
+    u32 first = 0;
+    while (columns[first] == 0) first++;
+    u32 last = k_row_bytes - 1;
+    while (columns[last] == 0) last--;
+    return {static_cast<i16>(first * 8 + static_cast<u32>(std::countl_zero(columns[first]))),
+            static_cast<i16>(First_row),
+            static_cast<i16>(last * 8 + 7 - static_cast<u32>(std::countr_zero(columns[last]))),
+            static_cast<i16>(Last_row)};
+}
+
+}  // namespace pico_oled::buffer
+
+#endif
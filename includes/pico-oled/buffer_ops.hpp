@@ -0,0 +1,92 @@
+#ifndef __PICO_OLED_BUFFER_OPS_HPP
+#define __PICO_OLED_BUFFER_OPS_HPP
+
+#include "imbuf.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+/// Whole-buffer kernels working on 32 bit words instead of bytes
+///
+/// The Cortex-M0+ loads and stores a word in the same time as a byte, so these touch the
+/// buffer a quarter as often as byte loops do. `Bytes` limits an operation to the start of the
+/// buffer, for images smaller than the panel.
+///
+/// Host builds on x86-64 also have SSE2 and AVX2 versions of the kernels, the best one the CPU
+/// supports is picked on first use. The Pico build only has the word kernels and calls them
+/// directly.
+namespace pico_oled::buffer {
+
+/// Sets of kernels one build can have
+enum class eKernelBackend : u8 { SCALAR, SSE2, AVX2 };
+
+/// Backend the kernels currently run on
+auto backend() -> eKernelBackend;
+
+/// Switches all kernels to `Backend`, e.g. to compare it against the scalar one. Returns false
+/// and keeps the current backend if this build or CPU does not have it.
+auto use_backend(eKernelBackend Backend) -> bool;
+
+/// Sets every byte to `Value`
+auto fill(ImBuf &dst, u8 Value, u32 Bytes = k_imsize) -> void;
+
+/// Inverts every pixel
+auto invert(ImBuf &dst, u32 Bytes = k_imsize) -> void;
+
+/// Copies `src` into `dst`
+auto copy(ImBuf &dst, const ImBuf &src, u32 Bytes = k_imsize) -> void;
+
+/// `dst &= src`, keeps the pixels lit in both
+auto and_with(ImBuf &dst, const ImBuf &src, u32 Bytes = k_imsize) -> void;
+
+/// `dst |= src`, lights the pixels lit in either
+auto or_with(ImBuf &dst, const ImBuf &src, u32 Bytes = k_imsize) -> void;
+
+/// `dst ^= src`, inverts the pixels lit in `src`
+auto xor_with(ImBuf &dst, const ImBuf &src, u32 Bytes = k_imsize) -> void;
+
+/// Takes the pixels of `src` where `mask` is lit and keeps `dst` elsewhere
+auto blend(ImBuf &dst, const ImBuf &src, const ImBuf &mask, u32 Bytes = k_imsize) -> void;
+
+/// Mirrors a 1 bpp bitmap of `Width` x `Height` pixels at its diagonal, pixel (x, y) of `src`
+/// becomes pixel (y, x) of `dst`. Both sizes are rounded down to multiples of 8, `dst` must
+/// have room for `Width` rows of `Height` / 8 bytes and must not overlap `src`.
+auto transpose(const u8 *src, u32 src_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height)
+    -> void;
+
+/// Turns a `Width` x `Height` image of 8 bit gray values into 1 bpp with an 8x8 ordered
+/// dither. Gray 0 stays dark, 255 is fully lit. The bits past `Width` in the last byte of a
+/// `dst` row are cleared.
+auto dither(const u8 *gray, u32 gray_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height)
+    -> void;
+
+/// Mirrors the image left to right, `dst` may be `src`
+auto flip_horizontal(ImBuf &dst, const ImBuf &src) -> void;
+
+auto flip_horizontal(ImBuf &buf) -> void;
+
+/// Mirrors the image top to bottom, `dst` may be `src`
+auto flip_vertical(ImBuf &dst, const ImBuf &src) -> void;
+
+auto flip_vertical(ImBuf &buf) -> void;
+
+/// Turns the image upside down, `dst` may be `src`
+auto rotate_180(ImBuf &dst, const ImBuf &src) -> void;
+
+auto rotate_180(ImBuf &buf) -> void;
+
+/// Turns the image clockwise, pixel (x, y) moves to (`k_height` - 1 - y, x). `dst` then holds
+/// an image `k_height` pixels wide and `k_width` high, in rows of `k_height` / 8 bytes. The
+/// buffers must differ.
+auto rotate_90(ImBuf &dst, const ImBuf &src) -> void;
+
+/// Turns the image counterclockwise, pixel (x, y) moves to (y, `k_width` - 1 - x), see
+/// `rotate_90` for the layout of `dst`
+auto rotate_270(ImBuf &dst, const ImBuf &src) -> void;
+
+/// Smallest rectangle holding every pixel that differs between two frames, in buffer
+/// coordinates as `Display::show_region` takes them. Empty if the frames match.
+auto diff(const ImBuf &Prev, const ImBuf &Next) -> Rect;
+
+}  // namespace pico_oled::buffer
+
+#endif
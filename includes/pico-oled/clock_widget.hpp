@@ -0,0 +1,65 @@
+#ifndef __PICO_OLED_CLOCK_WIDGET_HPP
+#define __PICO_OLED_CLOCK_WIDGET_HPP
+
+#include <array>
+
+#include "dirty_rects.hpp"
+#include "fonts.hpp"
+#include "paint.hpp"
+#include "paint_enums.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+namespace pico_oled::paint {
+
+/// `HH:MM:SS` clock that remembers what it drew and only redraws the characters that changed
+///
+/// The cells are laid out like `Paint::draw_time`, a changed digit is redrawn together with the
+/// parts of its neighbours overlapping its cell, so the result is the same as a full redraw.
+/// The background has to be opaque, as digits are drawn over their old selves.
+///
+/// The colors are taken in the order of `Paint::draw_char` and `Paint::draw_text`, glyphs in
+/// `Color_Foreground`. `Paint::draw_time` and `Paint::draw_en_string` pass their two colors
+/// to `draw_char` the other way around, so the same pixels as `draw_time(..., Fg, Bg)` come
+/// from a widget made with `Bg, Fg`.
+struct ClockWidget {
+   private:
+    static constexpr u8 k_cells = 8;
+
+    i32 m_x;
+    i32 m_y;
+    const font::Font *m_font;
+    eImageColors m_foreground;
+    eImageColors m_background;
+    /// Characters on screen, valid once drawn
+    std::array<char, k_cells> m_shown;
+    bool m_valid;
+
+    /// Left edge of cell `Index`
+    auto cell_x(u8 Index) const -> i32;
+
+    auto cell(u8 Index) const -> Rect;
+
+   public:
+    /// Clock at (`Xstart`, `Ystart`), drawn with glyphs of `Color_Foreground`
+    ClockWidget(i32 Xstart,
+                i32 Ystart,
+                const font::Font &Font,
+                eImageColors Color_Foreground,
+                eImageColors Color_Background);
+
+    /// Draws `Time`, only the cells that changed since the last call, and adds them to `Dirty`.
+    ///
+    /// Returns false if nothing had to be drawn.
+    auto draw(Paint &paint, const PaintTime &Time, DirtyRects &Dirty) -> bool;
+
+    /// Redraws every cell on the next `draw`, e.g. after the image was cleared
+    auto invalidate() -> void;
+
+    /// Area covered by the clock
+    auto bounds() const -> Rect;
+};
+
+}  // namespace pico_oled::paint
+
+#endif
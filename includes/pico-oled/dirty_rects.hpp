@@ -0,0 +1,89 @@
+#ifndef __PICO_OLED_DIRTY_RECTS_HPP
+#define __PICO_OLED_DIRTY_RECTS_HPP
+
+#include <array>
+
+#include "rect.hpp"
+#include "types.hpp"
+
+namespace pico_oled {
+
+/// Most rectangles tracked at once, further ones are merged into the closest
+static constexpr u8 k_dirty_rects = 8;
+
+/// Areas of an image changed since the last flush, kept as a few rectangles
+///
+/// Overlapping or touching rectangles are merged as they are added, so a run of neighbouring
+/// glyphs stays one rectangle. Widgets add what they redraw, the display loop flushes each
+/// rectangle with `Display::show_region` and clears the list.
+struct DirtyRects {
+   private:
+    std::array<Rect, k_dirty_rects> m_rects = {};
+    u8 m_count = 0;
+
+    static constexpr auto area(const Rect &r) -> i32 { return r.width() * r.height(); }
+
+    /// Overlapping or sharing an edge
+    static constexpr auto touches(const Rect &a, const Rect &b) -> bool {
+        return a.Xstart <= b.Xend + 1 && b.Xstart <= a.Xend + 1 && a.Ystart <= b.Yend + 1 &&
+               b.Ystart <= a.Yend + 1;
+    }
+
+   public:
+    /// Marks `Area` as changed
+    constexpr auto add(const Rect &Area) -> void {
+        if (Area.empty()) return;
+
+        Rect merged = Area;
+        // A merge can make the rectangle touch others, so merge until nothing is left to join
+        for (u8 i = 0; i < this->m_count;) {
+            if (touches(this->m_rects[i], merged)) {
+                merged = merged.unite(this->m_rects[i]);
+                this->m_rects[i] = this->m_rects[--this->m_count];
+                i = 0;
+            } else {
+                i++;
+            }
+        }
+
+        if (this->m_count == k_dirty_rects) {
+            // Full, the rectangle is folded into the one it grows the least
+            u8 best = 0;
+            i32 best_growth = 0;
+            for (u8 i = 0; i < this->m_count; i++) {
+                const i32 growth = area(this->m_rects[i].unite(merged)) - area(this->m_rects[i]);
+                if (i == 0 || growth < best_growth) {
+                    best = i;
+                    best_growth = growth;
+                }
+            }
+            merged = merged.unite(this->m_rects[best]);
+            this->m_rects[best] = this->m_rects[--this->m_count];
+        }
+        this->m_rects[this->m_count++] = merged;
+    }
+
+    /// Forgets all rectangles, after they were flushed
+    constexpr auto clear() -> void { this->m_count = 0; }
+
+    [[nodiscard]] constexpr auto empty() const -> bool { return this->m_count == 0; }
+
+    [[nodiscard]] constexpr auto size() const -> u8 { return this->m_count; }
+
+    /// Rectangle covering all changes, empty if there are none
+    [[nodiscard]] constexpr auto bounds() const -> Rect {
+        Rect all = {0, 0, -1, -1};
+        for (u8 i = 0; i < this->m_count; i++) all = all.unite(this->m_rects[i]);
+        return all;
+    }
+
+    [[nodiscard]] constexpr auto begin() const -> const Rect * { return this->m_rects.data(); }
+
+    [[nodiscard]] constexpr auto end() const -> const Rect * {
+        return this->m_rects.data() + this->m_count;
+    }
+};
+
+}  // namespace pico_oled
+
+#endif
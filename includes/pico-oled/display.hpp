@@ -38,6 +38,8 @@
 #include <array>
 #include <cstdio>
 
+#include "imbuf.hpp"
+#include "rect.hpp"
 #include "types.hpp"
 
 volatile static const auto SPI_PORT = spi0;
@@ -66,12 +68,6 @@ static constexpr auto EPD_SCL_PIN = 5;
 
 namespace pico_oled {
 
-static constexpr u8 k_width = 128;
-static constexpr u8 k_height = 64;
-static constexpr u32 k_imsize = k_width * k_height / 8;
-
-using ImBuf = std::array<u8, k_imsize>;
-
 enum class eConType { I2C, SPI };
 
 template <eConType T>
@@ -142,6 +138,28 @@ struct Display {
         }
     }
 
+    /// Sends only the part of the buffer within `Region`, given in buffer coordinates, see
+    /// `Paint::to_memory_rect`. The columns are widened to whole bytes.
+    auto show_region(const ImBuf &imbuf, const Rect &Region) const {
+        constexpr auto l_width = k_width / 8;
+        const Rect area = Region.intersect({0, 0, k_width - 1, k_height - 1});
+        if (area.empty()) return;
+
+        const auto first = static_cast<u8>(area.Xstart / 8);
+        const auto last = static_cast<u8>(area.Xend / 8);
+        for (i32 j = area.Ystart; j <= area.Yend; ++j) {
+            const auto column = static_cast<u8>(k_height - 1 - j);
+            // Each byte is a page, the row starts at the page of its first byte
+            write_to_reg(static_cast<u8>(0xB0u + first));
+            write_to_reg(static_cast<u8>(Regs::SET_LOW_COL_ADR + (column & 0x0Fu)));
+            write_to_reg(static_cast<u8>(Regs::SET_HIGH_COL_ADR + (column >> 0x04u)));
+
+            for (u8 i = first; i <= last; ++i) {
+                write_data(reverse_byte(imbuf[i + static_cast<u32>(j) * l_width]));
+            }
+        }
+    }
+
     auto clear() -> Display& {
         constexpr auto l_width = k_width / 8;
         // write starting row
@@ -0,0 +1,99 @@
+#ifndef __PICO_OLED_FFT_Q15_HPP
+#define __PICO_OLED_FFT_Q15_HPP
+
+#include <array>
+#include <bit>
+#include <span>
+
+#include "types.hpp"
+
+/// Fixed-point FFT for spectrum displays, no heap, no floats at runtime
+///
+/// Samples are Q15, the transform works in place on arrays of real and imaginary parts. Every
+/// stage halves its results, so nothing overflows and the output is the DFT divided by the
+/// number of points. The Cortex-M0+ multiplies in one cycle but has no divider, so the
+/// magnitudes are estimated without a square root.
+namespace pico_oled::dsp {
+
+/// Most points a transform can have, the twiddle and window tables are made for this many
+constexpr u16 k_fft_max_points = 256;
+
+namespace detail {
+
+constexpr double k_pi = 3.14159265358979323846;
+
+/// Sine for the tables, computed while compiling
+constexpr auto sine(double x) -> double {
+    // Into [-pi/2, pi/2], where the series converges quickly
+    while (x > k_pi) x -= 2 * k_pi;
+    while (x < -k_pi) x += 2 * k_pi;
+    if (x > k_pi / 2) x = k_pi - x;
+    if (x < -k_pi / 2) x = -k_pi - x;
+
+    double term = x;
+    double sum = x;
+    for (int i = 1; i < 12; i++) {
+        term *= -x * x / ((2 * i) * (2 * i + 1));
+        sum += term;
+    }
+    return sum;
+}
+
+constexpr auto to_q15(double x) -> i16 {
+    const double scaled = x * 32767.0;
+    return static_cast<i16>(scaled < 0 ? scaled - 0.5 : scaled + 0.5);
+}
+
+}  // namespace detail
+
+/// `sin(2 pi k / k_fft_max_points)` for the first half turn, in Q15
+constexpr auto make_twiddles() -> std::array<i16, k_fft_max_points / 2> {
+    std::array<i16, k_fft_max_points / 2> table = {};
+    for (u16 k = 0; k < table.size(); k++) {
+        table[k] = detail::to_q15(detail::sine(2 * detail::k_pi * k / k_fft_max_points));
+    }
+    return table;
+}
+
+/// Hann window over `k_fft_max_points` points, in Q15
+constexpr auto make_hann_window() -> std::array<i16, k_fft_max_points> {
+    std::array<i16, k_fft_max_points> table = {};
+    for (u16 k = 0; k < table.size(); k++) {
+        const double s = detail::sine(detail::k_pi * k / k_fft_max_points);
+        table[k] = detail::to_q15(s * s);
+    }
+    return table;
+}
+
+constexpr auto k_twiddles = make_twiddles();
+
+constexpr auto k_hann_window = make_hann_window();
+
+/// Multiplies `Samples` with a Hann window, so that a tone between two bins does not leak
+/// into the whole spectrum. The window is stretched over however many samples there are, at
+/// most `k_fft_max_points`.
+auto apply_hann(std::span<i16> Samples) -> void;
+
+/// Transforms `Real` and `Imag` in place into their spectrum divided by the number of points.
+/// Both must have the same power of two size from 2 to `k_fft_max_points`, returns false and
+/// leaves them alone otherwise. Values must stay within +-32767.
+auto fft(std::span<i16> Real, std::span<i16> Imag) -> bool;
+
+/// Magnitudes of the first `Magnitudes.size()` bins, estimated as the larger component plus
+/// 3/8 of the smaller one, within 7 percent of the true value
+auto magnitudes(std::span<const i16> Real, std::span<const i16> Imag, std::span<u16> Magnitudes)
+    -> void;
+
+/// `log2(Value)` in 8.8 fixed point, exact at powers of two and linear in between. 0 for 0.
+constexpr auto log2_q8(u32 Value) -> u16 {
+    if (Value == 0) return 0;
+    const auto whole = static_cast<u32>(std::bit_width(Value) - 1);
+    // The bits below the leading one, as a fraction of it
+    const u32 rest = Value - (u32{1} << whole);
+    const u32 fraction = whole >= 8 ? rest >> (whole - 8) : rest << (8 - whole);
+    return static_cast<u16>(whole << 8 | fraction);
+}
+
+}  // namespace pico_oled::dsp
+
+#endif
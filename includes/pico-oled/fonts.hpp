@@ -42,6 +42,9 @@
 #ifndef __PICO_OLED_FONTS_HPP
 #define __PICO_OLED_FONTS_HPP
 
+#include <array>
+#include <cstddef>
+
 #include "types.hpp"
 
 namespace pico_oled::font {
@@ -50,18 +53,135 @@ namespace pico_oled::font {
 constexpr auto MAX_HEIGHT_FONT = 41;
 constexpr auto MAX_WIDTH_FONT = 32;
 
+/// Glyphs in every table, the printable ASCII range ' ' to '~'
+constexpr auto GLYPH_COUNT = 95;
+/// Character of the first glyph
+constexpr char FIRST_CHAR = ' ';
+/// Character drawn in place of anything a font has no glyph for
+constexpr char FALLBACK_CHAR = '?';
+
+/// Ink extents of a glyph within its cell, all ends inclusive
+struct GlyphBox {
+    u8 top;
+    u8 bottom;
+    u8 left;
+    u8 right;
+
+    /// A glyph without any set bit, e.g. ' '
+    [[nodiscard]] constexpr auto empty() const -> bool { return top > bottom; }
+};
+
+/// Computes the ink box of every glyph of a font table at compile time
+template <std::size_t N>
+constexpr auto make_glyph_boxes(const u8 (&table)[N], u16 Width, u16 Height)
+    -> std::array<GlyphBox, GLYPH_COUNT> {
+    const std::size_t stride = (Width + 7u) / 8u;
+    static_assert(N % GLYPH_COUNT == 0, "font table must hold whole glyphs");
+
+    std::array<GlyphBox, GLYPH_COUNT> boxes = {};
+    for (std::size_t glyph = 0; glyph < GLYPH_COUNT; glyph++) {
+        GlyphBox box = {static_cast<u8>(Height), 0, static_cast<u8>(Width), 0};
+        for (std::size_t row = 0; row < Height; row++) {
+            for (std::size_t column = 0; column < Width; column++) {
+                const u8 byte = table[(glyph * Height + row) * stride + column / 8];
+                if (!(byte & (0x80u >> (column % 8)))) continue;
+                box.top = static_cast<u8>(row < box.top ? row : box.top);
+                box.bottom = static_cast<u8>(row > box.bottom ? row : box.bottom);
+                box.left = static_cast<u8>(column < box.left ? column : box.left);
+                box.right = static_cast<u8>(column > box.right ? column : box.right);
+            }
+        }
+        boxes[glyph] = box;
+    }
+    return boxes;
+}
+
+/// Index of the glyph for `c` in a font of `Count` glyphs starting at `FIRST_CHAR`
+constexpr auto glyph_index(char c, u16 Count, u16 Fallback) -> u16 {
+    const auto index = static_cast<u32>(static_cast<unsigned char>(c)) - FIRST_CHAR;
+    return index < Count ? static_cast<u16>(index) : Fallback;
+}
+
+/// Start of each glyph in a font table, for glyphs of `Height` rows of `Width` pixels
+constexpr auto make_glyph_offsets(u16 Width, u16 Height) -> std::array<u16, GLYPH_COUNT> {
+    const auto glyph_size = static_cast<u16>((Width + 7) / 8 * Height);
+    std::array<u16, GLYPH_COUNT> offsets = {};
+    for (std::size_t glyph = 0; glyph < GLYPH_COUNT; glyph++) {
+        offsets[glyph] = static_cast<u16>(glyph * glyph_size);
+    }
+    return offsets;
+}
+
+/// Transposes a font table into glyph columns at compile time. Each glyph becomes `Width`
+/// columns of `(Height + 7) / 8` bytes, the top row in the MSB, so that text rotated by 90 or
+/// 270 degrees lands on consecutive bits of a buffer row and can be blitted whole.
+template <u16 Width, u16 Height, std::size_t N>
+constexpr auto make_glyph_columns(const u8 (&table)[N])
+    -> std::array<u8, GLYPH_COUNT * Width * ((Height + 7) / 8)> {
+    constexpr std::size_t stride = (Width + 7u) / 8u;
+    constexpr std::size_t column_stride = (Height + 7u) / 8u;
+    static_assert(N == GLYPH_COUNT * Height * stride, "font table does not match its size");
+
+    std::array<u8, GLYPH_COUNT * Width * column_stride> columns = {};
+    for (std::size_t glyph = 0; glyph < GLYPH_COUNT; glyph++) {
+        for (std::size_t column = 0; column < Width; column++) {
+            const std::size_t base = (glyph * Width + column) * column_stride;
+            for (std::size_t row = 0; row < Height; row++) {
+                const u8 byte = table[(glyph * Height + row) * stride + column / 8];
+                if (!(byte & (0x80u >> (column % 8)))) continue;
+                u8 &bits = columns[base + row / 8];
+                bits = static_cast<u8>(bits | 0x80u >> (row % 8));
+            }
+        }
+    }
+    return columns;
+}
+
 // ASCII
 struct Font {
     const u8 *table;
     u16 Width;
     u16 Height;
+    /// Bytes per glyph row
+    u16 Stride;
+    /// Glyphs in `table`, starting at `FIRST_CHAR`
+    u16 Count;
+    /// Start of each glyph in `table`, see `make_glyph_offsets`
+    const u16 *offsets;
+    /// Ink box of each glyph, see `make_glyph_boxes`
+    const GlyphBox *boxes;
+    /// Glyph used for characters outside the font
+    u16 Fallback;
+    /// The glyphs transposed into columns, see `make_glyph_columns`. Only built with
+    /// `PICO_OLED_ROTATED_FONTS`, rotated text is drawn from the rows otherwise.
+    const u8 *columns = nullptr;
+
+    /// Glyph index of `c`, the fallback glyph if the font has none
+    [[nodiscard]] constexpr auto glyph_index(char c) const -> u16 {
+        return font::glyph_index(c, Count, Fallback);
+    }
+
+    /// First row of the glyph for `c`
+    [[nodiscard]] constexpr auto glyph(char c) const -> const u8 * {
+        return table + offsets[glyph_index(c)];
+    }
+
+    /// Bytes per glyph column
+    [[nodiscard]] constexpr auto column_stride() const -> u16 {
+        return static_cast<u16>((Height + 7) / 8);
+    }
+
+    /// First column of glyph `index`, null without the transposed table
+    [[nodiscard]] constexpr auto glyph_columns(u16 index) const -> const u8 * {
+        return columns ? columns + index * Width * column_stride() : nullptr;
+    }
 };
 
-extern Font Font24;
-extern Font Font20;
-extern Font Font16;
-extern Font Font12;
-extern Font Font8;
+extern const Font Font24;
+extern const Font Font20;
+extern const Font Font16;
+extern const Font Font12;
+extern const Font Font8;
 
 }  // namespace pico_oled::font
 
@@ -0,0 +1,22 @@
+#ifndef __PICO_OLED_IMBUF_HPP
+#define __PICO_OLED_IMBUF_HPP
+
+#include <array>
+
+#include "types.hpp"
+
+namespace pico_oled {
+
+static constexpr u8 k_width = 128;
+static constexpr u8 k_height = 64;
+static constexpr u32 k_imsize = k_width * k_height / 8;
+
+/// 1 bpp frame buffer, word aligned so that the kernels of `buffer_ops.hpp` can work on whole
+/// 32 bit words
+struct alignas(4) ImBuf : std::array<u8, k_imsize> {};
+
+static_assert(k_imsize % 4 == 0, "the buffer kernels expect whole words");
+
+}  // namespace pico_oled
+
+#endif
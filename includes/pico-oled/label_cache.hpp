@@ -0,0 +1,88 @@
+#ifndef __PICO_OLED_LABEL_CACHE_HPP
+#define __PICO_OLED_LABEL_CACHE_HPP
+
+#include <array>
+#include <span>
+#include <string_view>
+
+#include "fonts.hpp"
+#include "paint.hpp"
+#include "paint_enums.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+namespace pico_oled::paint {
+
+/// Most labels cached at once
+static constexpr u8 k_label_slots = 16;
+
+/// Static text rasterized once into 1 bpp bitmaps, so that drawing it again is a single blit
+///
+/// Labels are keyed by their text and font, the colors are applied when blitting, so one entry
+/// serves every color pair. Bitmaps and a copy of their text live in an arena the caller
+/// provides, its size is the byte budget. When a new label does not fit, the least recently
+/// drawn ones are evicted and the arena is compacted.
+///
+///     static std::array<u8, 1024> label_arena;
+///     LabelCache labels(label_arena);
+///     labels.draw(paint, 10, 10, "Pico-OLED", font::Font16, WHITE, BLACK);
+struct LabelCache {
+   private:
+    struct Entry {
+        const font::Font *font;
+        /// Start of the text in the arena, the bitmap follows it
+        u32 offset;
+        /// Characters of the text
+        u16 length;
+        u16 stride;
+        u32 last_used;
+
+        [[nodiscard]] auto bitmap_bytes() const -> u32 {
+            return static_cast<u32>(stride) * font->Height;
+        }
+
+        [[nodiscard]] auto bytes() const -> u32 { return length + bitmap_bytes(); }
+    };
+
+    std::span<u8> m_arena;
+    u32 m_used;
+    std::array<Entry, k_label_slots> m_entries;
+    u8 m_count;
+    u32 m_clock;
+
+    auto find(std::string_view Text, const font::Font &Font) -> Entry *;
+
+    /// Rasterizes `Text` into a new entry, null if it can never fit the arena
+    auto insert(std::string_view Text, const font::Font &Font) -> Entry *;
+
+    /// Drops the least recently drawn label and closes the gap it leaves
+    auto evict() -> void;
+
+   public:
+    explicit LabelCache(std::span<u8> Arena);
+
+    /// Draws `Text` on one line at (`Xpoint`, `Ypoint`) like `Paint::draw_text`, from the
+    /// cached bitmap if there is one. Labels too big for the arena are drawn glyph by glyph.
+    ///
+    /// Returns the area of the label.
+    auto draw(Paint &paint,
+              i32 Xpoint,
+              i32 Ypoint,
+              std::string_view Text,
+              const font::Font &Font,
+              eImageColors Color_Foreground,
+              eImageColors Color_Background) -> Rect;
+
+    /// Evicts every label
+    auto clear() -> void;
+
+    /// Arena bytes in use
+    [[nodiscard]] auto used() const -> u32;
+
+    /// Labels cached
+    [[nodiscard]] auto size() const -> u8;
+};
+
+}  // namespace pico_oled::paint
+
+#endif
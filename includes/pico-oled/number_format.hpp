@@ -0,0 +1,92 @@
+#ifndef __PICO_OLED_NUMBER_FORMAT_HPP
+#define __PICO_OLED_NUMBER_FORMAT_HPP
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace pico_oled::text {
+
+/// Most digits after the decimal point, 10^9 still fits a u32
+constexpr u8 k_max_decimals = 9;
+
+/// Longest formatted number: sign, ten integer digits, point and `k_max_decimals` digits. Wider
+/// fields are cut to this.
+constexpr u8 k_max_number_chars = 1 + 10 + 1 + k_max_decimals;
+
+constexpr std::array<u32, k_max_decimals + 1> k_powers_of_ten = {
+    1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000, 1'000'000'000};
+
+/// A formatted number, kept on the stack and null terminated
+struct NumberText {
+    std::array<char, k_max_number_chars + 1> chars;
+    u8 length;
+
+    [[nodiscard]] constexpr auto view() const -> std::string_view { return {chars.data(), length}; }
+
+    [[nodiscard]] constexpr auto c_str() const -> const char * { return chars.data(); }
+};
+
+/// Formats `Integer` and `Decimals` digits of `Fraction` as "-123.045", right aligned in a
+/// field of `Width` characters filled with `Pad`. Zeros are padded after the sign, anything
+/// else before it. There is always at least one integer digit.
+constexpr auto format_number(bool Negative,
+                             u32 Integer,
+                             u32 Fraction,
+                             u8 Decimals,
+                             u8 Width = 0,
+                             char Pad = ' ') -> NumberText {
+    Decimals = Decimals < k_max_decimals ? Decimals : k_max_decimals;
+    Width = Width < k_max_number_chars ? Width : k_max_number_chars;
+
+    // Digits are produced from the right, into the end of the buffer
+    std::array<char, k_max_number_chars> digits = {};
+    std::size_t first = digits.size();
+    if (Decimals > 0) {
+        for (u8 i = 0; i < Decimals; i++, Fraction /= 10) {
+            digits[--first] = static_cast<char>('0' + Fraction % 10);
+        }
+        digits[--first] = '.';
+    }
+    do {
+        digits[--first] = static_cast<char>('0' + Integer % 10);
+        Integer /= 10;
+    } while (Integer > 0);
+
+    const std::size_t used = digits.size() - first + (Negative ? 1 : 0);
+    std::size_t padding = Width > used ? Width - used : 0;
+
+    NumberText text = {};
+    std::size_t length = 0;
+    if (Pad != '0') {
+        for (; padding > 0; padding--) text.chars[length++] = Pad;
+    }
+    if (Negative) text.chars[length++] = '-';
+    for (; padding > 0; padding--) text.chars[length++] = '0';
+    for (std::size_t i = first; i < digits.size(); i++) text.chars[length++] = digits[i];
+
+    text.chars[length] = '\0';
+    text.length = static_cast<u8>(length);
+    return text;
+}
+
+/// Formats `Value` in decimal, see `format_number` for the field
+constexpr auto format_int(i32 Value, u8 Width = 0, char Pad = ' ') -> NumberText {
+    // Negated as unsigned, so that the lowest i32 has a magnitude too
+    const u32 magnitude = Value < 0 ? 0u - static_cast<u32>(Value) : static_cast<u32>(Value);
+    return format_number(Value < 0, magnitude, 0, 0, Width, Pad);
+}
+
+/// Formats the fixed-point number `Value / 10^Decimals`, e.g. 2345 with 2 decimals as "23.45"
+constexpr auto format_fixed(i32 Value, u8 Decimals, u8 Width = 0, char Pad = ' ') -> NumberText {
+    Decimals = Decimals < k_max_decimals ? Decimals : k_max_decimals;
+    const u32 magnitude = Value < 0 ? 0u - static_cast<u32>(Value) : static_cast<u32>(Value);
+    const u32 unit = k_powers_of_ten[Decimals];
+    return format_number(Value < 0, magnitude / unit, magnitude % unit, Decimals, Width, Pad);
+}
+
+}  // namespace pico_oled::text
+
+#endif
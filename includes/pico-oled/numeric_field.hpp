@@ -0,0 +1,70 @@
+#ifndef __PICO_OLED_NUMERIC_FIELD_HPP
+#define __PICO_OLED_NUMERIC_FIELD_HPP
+
+#include <array>
+#include <string_view>
+
+#include "dirty_rects.hpp"
+#include "fonts.hpp"
+#include "number_format.hpp"
+#include "paint.hpp"
+#include "paint_enums.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+namespace pico_oled::paint {
+
+/// Live numeric readout in a fixed row of character cells
+///
+/// The value is formatted right aligned into the cells, compared with what is on screen and
+/// only the cells whose character changed are redrawn. Values wider than the field show as
+/// '#' in every cell. The background has to be opaque, as characters are drawn over their old
+/// selves.
+struct NumericField {
+   private:
+    i32 m_x;
+    i32 m_y;
+    const font::Font *m_font;
+    eImageColors m_foreground;
+    eImageColors m_background;
+    /// Cells of the field
+    u8 m_width;
+    /// Digits after the point, the values are fixed point `Value / 10^m_decimals`
+    u8 m_decimals;
+    char m_pad;
+    /// Characters on screen, valid once drawn
+    std::array<char, text::k_max_number_chars> m_shown;
+    bool m_valid;
+
+    auto cell(u8 Index) const -> Rect;
+
+   public:
+    /// Field of `Width` cells at (`Xstart`, `Ystart`), at most `text::k_max_number_chars`
+    NumericField(i32 Xstart,
+                 i32 Ystart,
+                 u8 Width,
+                 const font::Font &Font,
+                 eImageColors Color_Foreground,
+                 eImageColors Color_Background,
+                 u8 Decimals = 0,
+                 char Pad = ' ');
+
+    /// Shows `Value`, redrawing only the changed cells, and adds those to `Dirty`.
+    ///
+    /// Returns false if nothing had to be drawn.
+    auto draw(Paint &paint, i32 Value, DirtyRects &Dirty) -> bool;
+
+    /// Shows `Text` right aligned in the field like a formatted value, e.g. "--" for no reading.
+    /// Free text is padded with spaces, not with the pad character of the numbers.
+    auto draw(Paint &paint, std::string_view Text, DirtyRects &Dirty) -> bool;
+
+    /// Redraws every cell on the next `draw`, e.g. after the image was cleared
+    auto invalidate() -> void;
+
+    /// Area covered by the field
+    auto bounds() const -> Rect;
+};
+
+}  // namespace pico_oled::paint
+
+#endif
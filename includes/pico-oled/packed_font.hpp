@@ -0,0 +1,83 @@
+#ifndef __PICO_OLED_PACKED_FONT_HPP
+#define __PICO_OLED_PACKED_FONT_HPP
+
+#include <algorithm>
+#include <array>
+
+#include "fonts.hpp"
+#include "types.hpp"
+
+namespace pico_oled::font {
+
+/// Bit-packed font as emitted by `tools/pack_font.py`, either complete or a subset
+///
+/// Each glyph is cropped to its ink box, the pixels inside are one MSB first bit stream starting
+/// at `data + offsets[glyph]`. Blank glyphs store nothing.
+struct PackedFont {
+    const u8 *data;
+    u16 Width;
+    u16 Height;
+    /// Bytes per row of a decoded glyph
+    u16 Stride;
+    /// Glyphs in the font
+    u16 Count;
+    /// Character of each glyph in ascending order for subset fonts, `nullptr` if the glyphs run
+    /// from `FIRST_CHAR` without gaps
+    const u8 *codes;
+    const u16 *offsets;
+    const GlyphBox *boxes;
+    /// Glyph used for characters outside the font
+    u16 Fallback;
+
+    /// Glyph index of `c`, the fallback glyph if the font has none
+    [[nodiscard]] constexpr auto glyph_index(char c) const -> u16 {
+        if (codes == nullptr) return font::glyph_index(c, Count, Fallback);
+
+        const auto code = static_cast<u8>(c);
+        const auto *found = std::lower_bound(codes, codes + Count, code);
+        return found != codes + Count && *found == code ? static_cast<u16>(found - codes)
+                                                        : Fallback;
+    }
+};
+
+/// Largest decoded glyph in bytes
+constexpr auto MAX_GLYPH_BYTES = (MAX_WIDTH_FONT + 7) / 8 * MAX_HEIGHT_FONT;
+
+/// Decoded glyphs kept by a `GlyphCache`
+constexpr auto GLYPH_CACHE_SLOTS = 8;
+
+/// Unpacks glyph `index` into `Height` rows of `Stride` bytes, the layout of a `Font` table
+auto decode_glyph(const PackedFont &Font, u16 index, u8 *rows) -> void;
+
+/// Keeps the most recently drawn glyphs of packed fonts decoded in RAM
+///
+/// Repeated characters decode once, a miss evicts the least recently used glyph.
+struct GlyphCache {
+   private:
+    struct Slot {
+        const PackedFont *font;
+        u16 index;
+        /// Value of `m_clock` when last used
+        u32 used;
+        std::array<u8, MAX_GLYPH_BYTES> rows;
+    };
+    std::array<Slot, GLYPH_CACHE_SLOTS> m_slots = {};
+    u32 m_clock = 0;
+
+   public:
+    /// Decoded rows of glyph `index` of `Font`
+    auto get(const PackedFont &Font, u16 index) -> const u8 *;
+
+    /// Drops all glyphs, e.g. before a font goes away
+    auto clear() -> void;
+};
+
+extern const PackedFont Font24Packed;
+extern const PackedFont Font20Packed;
+extern const PackedFont Font16Packed;
+extern const PackedFont Font12Packed;
+extern const PackedFont Font8Packed;
+
+}  // namespace pico_oled::font
+
+#endif
@@ -1,9 +1,16 @@
 #ifndef __PICO_OLED_PAINT_HPP
 #define __PICO_OLED_PAINT_HPP
 
-#include "display.hpp"
+#include <array>
+#include <string_view>
+
 #include "fonts.hpp"
+#include "imbuf.hpp"
+#include "number_format.hpp"
+#include "packed_font.hpp"
 #include "paint_enums.hpp"
+#include "rect.hpp"
+#include "text_layout.hpp"
 #include "types.hpp"
 
 namespace pico_oled::paint {
@@ -20,6 +27,9 @@ struct PaintTime {
     u8 Sec;    // 0 - 59
 };
 
+/// Depth of the clip rectangle stack, see `Paint::push_clip`
+static constexpr u8 k_clip_depth = 8;
+
 /// Image attributes
 ///
 /// Holds an image that is drawn upon
@@ -36,6 +46,15 @@ struct Paint {
     u16 m_width_byte;
     u16 m_height_byte;
     eScaling m_scale;
+    /// Active clip rectangle in logical coordinates, always within the image
+    Rect m_clip;
+    /// Clip rectangles saved by `push_clip`
+    std::array<Rect, k_clip_depth> m_clip_stack;
+    u8 m_clip_depth;
+#ifdef PICO_OLED_PACKED_FONTS
+    /// Decoded glyphs of the packed fonts drawn recently
+    font::GlyphCache m_glyph_cache;
+#endif
 
    public:
     /// Init and create new image
@@ -52,35 +71,62 @@ struct Paint {
 
     auto get_image() const -> const ImBuf &;
 
+    /// Sets the rotation, swaps the logical width and height if needed and resets the clip
     auto set_rotation(const eRotation rotation) -> void;
 
     auto set_mirror_orientation(eMirrorOrientiation mirror) -> void;
 
-    auto draw_pixel(u16 Xpoint, u16 Ypoint, eImageColors Color) -> void;
+    /// Restricts all drawing to `clip`, intersected with the currently active clip rectangle.
+    ///
+    /// Returns false, without changing the clip, if the stack is already `k_clip_depth` deep.
+    auto push_clip(const Rect &clip) -> bool;
+
+    /// Restores the clip rectangle that was active before the last `push_clip`
+    auto pop_clip() -> void;
+
+    /// Active clip rectangle, the whole image unless narrowed by `push_clip`
+    auto get_clip() const -> const Rect &;
+
+    /// Buffer area covered by the logical rectangle `Area`, e.g. to flush it with
+    /// `Display::show_region`
+    auto to_memory_rect(const Rect &Area) const -> Rect;
+
+    /// Draws a single pixel, pixels outside the clip rectangle are ignored
+    auto draw_pixel(i32 Xpoint, i32 Ypoint, eImageColors Color) -> void;
 
     /// Sets scaling and updates `m_width_byte`
     auto set_scale(eScaling scale) -> void;
 
     auto clear_color(eImageColors Color) -> void;
 
-    /// Clear color of window
-    auto ClearWindows(u16 Xstart, u16 Ystart, u16 Xend, u16 Yend, eImageColors Color) -> void;
+    /// Clear color of window, `Xend` and `Yend` are exclusive
+    auto ClearWindows(i32 Xstart, i32 Ystart, i32 Xend, i32 Yend, eImageColors Color) -> void;
+
+    /// Moves the pixels within `Area` by `Dx` to the right and `Dy` down, e.g. to advance a
+    /// chart by one sample and draw only the new column. Pixels pushed out of the area are
+    /// dropped, the strips left behind are filled with `Fill`. Only the part of `Area` within
+    /// the clip rectangle is touched. Needs a 1 bpp image.
+    auto scroll_region(const Rect &Area, i32 Dx, i32 Dy, eImageColors Fill) -> void;
 
     // Draw point
-    auto draw_point(u16 Xpoint,
-                    u16 Ypoint,
+    auto draw_point(i32 Xpoint,
+                    i32 Ypoint,
                     eImageColors Color,
                     eDotSize Dot_Pixel,
                     eDotStyle Dot_FillWay = eDotStyle::DOT_FILL_DEFAULT) -> void;
 
     /// Draw line with arbitraty slope
-    auto draw_line(u16 Xstart,
-                   u16 Ystart,
-                   u16 Xend,
-                   u16 Yend,
+    ///
+    /// Lines wider than one pixel are filled as a single polygon, `Line_Cap` selects how their
+    /// ends are closed.
+    auto draw_line(i32 Xstart,
+                   i32 Ystart,
+                   i32 Xend,
+                   i32 Yend,
                    eImageColors Color,
                    eDotSize Line_width,
-                   eLineStyle Line_Style) -> void;
+                   eLineStyle Line_Style,
+                   eLineCap Line_Cap = eLineCap::LINE_CAP_DEFAULT) -> void;
 
     /// Draw a rectangle
     /// @params:
@@ -91,10 +137,10 @@ struct Paint {
     ///     Color  ：The color of the Rectangular segment,
     ///     Line_width: Line width,
     ///     Draw_Fill : Whether to fill the inside of the rectangle,
-    auto draw_rectangle(u16 Xstart,
-                        u16 Ystart,
-                        u16 Xend,
-                        u16 Yend,
+    auto draw_rectangle(i32 Xstart,
+                        i32 Ystart,
+                        i32 Xend,
+                        i32 Yend,
                         eImageColors Color,
                         eDotSize Line_width,
                         eDrawFilling Draw_Fill) -> void;
@@ -107,8 +153,8 @@ struct Paint {
     ///    Color     ：The color of the ：circle segment,
     ///    Line_width: Line width,
     ///    Draw_Fill : Whether to fill the inside of the Circle,
-    auto draw_circle(u16 X_Center,
-                     u16 Y_Center,
+    auto draw_circle(i32 X_Center,
+                     i32 Y_Center,
                      u16 Radius,
                      eImageColors Color,
                      eDotSize Line_width,
@@ -123,12 +169,15 @@ struct Paint {
     ///    Font             ：A structure pointer that displays a character size,
     ///    Color_Foreground : Select the foreground color,
     ///    Color_Background : Select the background color,
-    auto draw_char(u16 Xstart,
-                   u16 Ystart,
+    ///    Scale            : Integer magnification from 1 to 4, each font pixel becomes a
+    ///                       `Scale` x `Scale` square,
+    auto draw_char(i32 Xstart,
+                   i32 Ystart,
                    const char Acsii_Char,
                    const font::Font &Font,
                    eImageColors Color_Foreground,
-                   eImageColors Color_Background) -> void;
+                   eImageColors Color_Background,
+                   u8 Scale = 1) -> void;
 
     /// Display the string
     ///
@@ -139,12 +188,61 @@ struct Paint {
     ///     Font             ：A structure pointer that displays a character size,
     ///     Color_Foreground : Select the foreground color,
     ///     Color_Background : Select the background color,
+    ///     Scale            : Integer magnification from 1 to 4, see `draw_char`,
     auto draw_en_string(u16 Xstart,
                         u16 Ystart,
                         const char *pString,
                         const font::Font &Font,
                         eImageColors Color_Foreground,
-                        eImageColors Color_Background) -> void;
+                        eImageColors Color_Background,
+                        u8 Scale = 1) -> void;
+
+#ifdef PICO_OLED_PACKED_FONTS
+    /// Show a character of a bit-packed font, glyphs are decoded once into the glyph cache
+    auto draw_char(i32 Xstart,
+                   i32 Ystart,
+                   const char Acsii_Char,
+                   const font::PackedFont &Font,
+                   eImageColors Color_Foreground,
+                   eImageColors Color_Background,
+                   u8 Scale = 1) -> void;
+
+    /// Display a string in a bit-packed font
+    auto draw_en_string(u16 Xstart,
+                        u16 Ystart,
+                        const char *pString,
+                        const font::PackedFont &Font,
+                        eImageColors Color_Foreground,
+                        eImageColors Color_Background,
+                        u8 Scale = 1) -> void;
+#endif
+
+    /// Lays `Text` out in `Box`. Lines break at '\n' and wrap at spaces to the width of the
+    /// box, each is placed by `Align`, and the glyphs are clipped to the box. Lines are stacked
+    /// from the top of the box as long as they fit whole.
+    ///
+    /// Unlike `draw_en_string` the glyphs are drawn in `Color_Foreground`. An opaque
+    /// `Color_Background` fills the whole box first, so text drawn there before is erased.
+    ///
+    /// Returns the rest of `Text` that did not fit.
+    auto draw_text(const Rect &Box,
+                   std::string_view Text,
+                   const font::Font &Font,
+                   eImageColors Color_Foreground,
+                   eImageColors Color_Background,
+                   eTextAlign Align = eTextAlign::ALIGN_LEFT,
+                   u8 Scale = 1) -> std::string_view;
+
+#ifdef PICO_OLED_PACKED_FONTS
+    /// Lays out text in a bit-packed font, see `draw_text`
+    auto draw_text(const Rect &Box,
+                   std::string_view Text,
+                   const font::PackedFont &Font,
+                   eImageColors Color_Foreground,
+                   eImageColors Color_Background,
+                   eTextAlign Align = eTextAlign::ALIGN_LEFT,
+                   u8 Scale = 1) -> std::string_view;
+#endif
 
     /// Display nummber
     ///
@@ -153,7 +251,7 @@ struct Paint {
     ///     Ystart           : Y coordinate,
     ///     Nummber          : The number displayed,
     ///     Font             ：A structure pointer that displays a character size,
-    ///     Digit            : Fractional width,
+    ///     Digit            : Fractional width, at most `text::k_max_decimals`,
     ///     Color_Foreground : Select the foreground color,
     ///     Color_Background : Select the background color,
     auto draw_number(u16 Xpoint,
@@ -164,6 +262,30 @@ struct Paint {
                      eImageColors Color_Foreground,
                      eImageColors Color_Background) -> void;
 
+    /// Draws `Value` in decimal as one run of characters, right aligned in a field of `Width`
+    /// characters filled with `Pad`. Formatted without heap or float math, see
+    /// `text::format_int`. `Color_Foreground` is the glyph color.
+    auto draw_int(i32 Xpoint,
+                  i32 Ypoint,
+                  i32 Value,
+                  const font::Font &Font,
+                  eImageColors Color_Foreground,
+                  eImageColors Color_Background,
+                  u8 Width = 0,
+                  char Pad = ' ') -> void;
+
+    /// Draws the fixed-point number `Value / 10^Decimals`, e.g. a temperature in hundredths
+    /// of a degree with 2 decimals, like `draw_int`
+    auto draw_fixed(i32 Xpoint,
+                    i32 Ypoint,
+                    i32 Value,
+                    u8 Decimals,
+                    const font::Font &Font,
+                    eImageColors Color_Foreground,
+                    eImageColors Color_Background,
+                    u8 Width = 0,
+                    char Pad = ' ') -> void;
+
     /// Display time
     ///
     /// parameter:
@@ -189,6 +311,36 @@ struct Paint {
     ///    and then embed the array directly into Imagedata.cpp as a .c file.
     auto draw_bitmap(const unsigned char *image_buffer) -> void;
 
+    /// Combines a 1 bpp bitmap with the image, clipped to the clip rectangle
+    ///
+    /// @params:
+    ///    src           : Bitmap rows, MSB first, a set bit is a lit pixel
+    ///    src_stride    : Bytes from one bitmap row to the next
+    ///    Xstart/Ystart : Where the top left bitmap pixel lands
+    ///    Width/Height  : Size of the bitmap in pixels
+    ///    Rop           : How bitmap bits combine with the image
+    /// @note:
+    ///    Whenever bitmap rows run along buffer rows (no rotation by 90/270 degrees, no
+    ///    horizontal mirroring) whole buffer bytes are combined at once.
+    auto blit(const u8 *src,
+              u16 src_stride,
+              i32 Xstart,
+              i32 Ystart,
+              u16 Width,
+              u16 Height,
+              eRasterOp Rop = eRasterOp::ROP_COPY) -> void;
+
+    /// Draws a 1 bpp mask like a glyph: set bits in `Color_Foreground`, clear bits in
+    /// `Color_Background` or left alone if that is `FONT_BACKGROUND`
+    auto draw_mask(const u8 *src,
+                   u16 src_stride,
+                   i32 Xstart,
+                   i32 Ystart,
+                   u16 Width,
+                   u16 Height,
+                   eImageColors Color_Foreground,
+                   eImageColors Color_Background) -> void;
+
     auto draw_bitmap_block(const unsigned char *image_buffer, u8 Region) -> void;
 
     auto draw_image(const unsigned char *image, u16 xStart, u16 yStart, u16 W_Image, u16 H_Image)
@@ -196,6 +348,126 @@ struct Paint {
 
     auto bmp_windows(const u8 x, const u8 y, const u8 *pBmp, const u8 chWidth, const u8 chHeight)
         -> void;
+
+   private:
+    /// Maps a logical coordinate to buffer coordinates, applying rotation and mirroring.
+    auto to_memory(i32 Xpoint, i32 Ypoint, i32 &X, i32 &Y) const -> void;
+
+    /// Writes a pixel that is already known to lie within the clip rectangle
+    auto put_pixel(i32 Xpoint, i32 Ypoint, eImageColors Color) -> void;
+
+    /// Inverts every bit of a pixel that is already known to lie within the clip rectangle
+    auto invert_pixel(i32 Xpoint, i32 Ypoint) -> void;
+
+    /// Fills the inclusive logical rectangle, clipped to the clip rectangle.
+    ///
+    /// Rotation and mirroring keep rectangles axis aligned, so the rectangle is transformed
+    /// once and then filled byte-wise in buffer space.
+    auto fill_rect(i32 Xstart, i32 Ystart, i32 Xend, i32 Yend, eImageColors Color) -> void;
+
+    /// Fills the inclusive horizontal span `[Xstart, Xend]` on row `Ypoint`.
+    auto fill_span(i32 Xstart, i32 Xend, i32 Ypoint, eImageColors Color) -> void {
+        this->fill_rect(Xstart, Ypoint, Xend, Ypoint, Color);
+    }
+
+    /// Fills the inclusive rectangle given in buffer coordinates, no bounds checks.
+    auto fill_rect_memory(u16 Xstart, u16 Ystart, u16 Xend, u16 Yend, eImageColors Color) -> void;
+
+    /// Moves the pixels of the inclusive rectangle given in buffer coordinates by `Dx`, `Dy`,
+    /// no bounds checks. Whole rows are moved with memmove, bits within a row are shifted across
+    /// bytes. Leaves the uncovered strips as they were.
+    auto scroll_memory(u16 Xstart, u16 Ystart, u16 Xend, u16 Yend, i32 Dx, i32 Dy) -> void;
+
+    /// Draws a `Side` wide square dot from a precomputed row stamp, trimmed to the clip
+    auto stamp_dot(i32 Xstart, i32 Ystart, i32 Side, eImageColors Color) -> void;
+
+    /// Rasterizes a one pixel wide line straight into the buffer, clipped to the clip rectangle.
+    ///
+    /// Returns false when the current scaling cannot be drawn directly, the caller then falls
+    /// back to `draw_point`.
+    auto raster_line(i32 Xstart, i32 Ystart, i32 Xend, i32 Yend, eImageColors Color) -> bool;
+
+    /// Fills a line of `2 * Half_width + 1` pixels across as a convex polygon, one span per row
+    auto fill_thick_line(i32 Xstart,
+                         i32 Ystart,
+                         i32 Xend,
+                         i32 Yend,
+                         i32 Half_width,
+                         eLineCap Line_Cap,
+                         eImageColors Color) -> void;
+
+    /// Blits a bitmap stored as `Width` columns of `src_stride` bytes, starting at bit `src_y`
+    /// of each column. Only done when the logical columns run along buffer rows, i.e. rotated
+    /// by 90 or 270 degrees, returns false otherwise. Columns are at most 32 bits.
+    auto blit_columns(const u8 *src,
+                      u16 src_stride,
+                      u16 src_y,
+                      i32 Xstart,
+                      i32 Ystart,
+                      u16 Width,
+                      u16 Height,
+                      eRasterOp Rop) -> bool;
+
+    /// Draws a 1 bpp bitmap pixel by pixel magnified `Scale` times, set bits in
+    /// `Color_Foreground` and clear bits in `Color_Background` unless that is
+    /// `FONT_BACKGROUND`. Keeps the exact colors of multi-bit scalings, which blits cannot.
+    auto draw_bits(const u8 *src,
+                   u16 src_stride,
+                   i32 Xstart,
+                   i32 Ystart,
+                   u16 Width,
+                   u16 Height,
+                   u8 Scale,
+                   eImageColors Color_Foreground,
+                   eImageColors Color_Background) -> void;
+
+    /// Draws a glyph of `Height` rows of `Stride` bytes magnified `Scale` times, `box` bounds
+    /// its set bits. `columns` holds the same glyph transposed, or is null.
+    auto draw_glyph(i32 Xpoint,
+                    i32 Ypoint,
+                    const u8 *glyph,
+                    u16 Stride,
+                    const u8 *columns,
+                    u16 Width,
+                    u16 Height,
+                    const font::GlyphBox &box,
+                    eImageColors Color_Foreground,
+                    eImageColors Color_Background,
+                    u8 Scale) -> void;
+
+    /// Lays out a string for either font format, see `draw_en_string`
+    template <typename FontT>
+    auto draw_string(u16 Xstart,
+                     u16 Ystart,
+                     const char *pString,
+                     const FontT &Font,
+                     eImageColors Color_Foreground,
+                     eImageColors Color_Background,
+                     u8 Scale) -> void;
+
+    /// Draws `Text` as one line from (`Xpoint`, `Ypoint`) without wrapping
+    auto draw_run(i32 Xpoint,
+                  i32 Ypoint,
+                  std::string_view Text,
+                  const font::Font &Font,
+                  eImageColors Color_Foreground,
+                  eImageColors Color_Background) -> void;
+
+    /// Lays out text for either font format, see `draw_text`
+    template <typename FontT>
+    auto layout_text(const Rect &Box,
+                     std::string_view Text,
+                     const FontT &Font,
+                     eImageColors Color_Foreground,
+                     eImageColors Color_Background,
+                     eTextAlign Align,
+                     u8 Scale) -> std::string_view;
+
+    /// Draws a filled disc as one span per scanline
+    auto fill_disc(i32 X_Center, i32 Y_Center, i32 Radius, eImageColors Color) -> void;
+
+    /// Draws the ring between `Inner` (exclusive) and `Outer` (inclusive) radius as spans
+    auto fill_ring(i32 X_Center, i32 Y_Center, i32 Inner, i32 Outer, eImageColors Color) -> void;
 };
 }  // namespace pico_oled::paint
 #endif
@@ -79,6 +79,36 @@ enum class eLineStyle {
     LINE_STYLE_DOTTED,
 };
 
+/**
+ * End caps of thick lines
+ **/
+enum class eLineCap {
+    LINE_CAP_BUTT = 0,  // ends flush with the endpoints
+    LINE_CAP_SQUARE,    // extended by half the line width, like a square dot
+    LINE_CAP_ROUND,     // half discs around the endpoints
+    LINE_CAP_DEFAULT = LINE_CAP_SQUARE
+};
+
+/**
+ * How a blitted source bit combines with the image
+ **/
+enum class eRasterOp {
+    ROP_COPY = 0,  // image = source
+    ROP_OR,        // lit where the source is set
+    ROP_AND,       // cleared where the source is clear
+    ROP_AND_NOT,   // cleared where the source is set
+    ROP_XOR,       // inverted where the source is set
+};
+
+/**
+ * Horizontal placement of text lines within their box
+ **/
+enum class eTextAlign {
+    ALIGN_LEFT = 0,
+    ALIGN_CENTER,
+    ALIGN_RIGHT,
+};
+
 /**
  * Whether the graphic is filled
  **/
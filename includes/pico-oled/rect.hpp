@@ -0,0 +1,50 @@
+#ifndef __PICO_OLED_RECT_HPP
+#define __PICO_OLED_RECT_HPP
+
+#include <algorithm>
+
+#include "types.hpp"
+
+namespace pico_oled {
+
+/// Axis aligned rectangle covering `[Xstart, Xend] x [Ystart, Yend]`, both ends inclusive
+struct Rect {
+    i16 Xstart;
+    i16 Ystart;
+    i16 Xend;
+    i16 Yend;
+
+    [[nodiscard]] constexpr auto empty() const -> bool { return Xstart > Xend || Ystart > Yend; }
+
+    [[nodiscard]] constexpr auto width() const -> i32 { return empty() ? 0 : Xend - Xstart + 1; }
+
+    [[nodiscard]] constexpr auto height() const -> i32 { return empty() ? 0 : Yend - Ystart + 1; }
+
+    [[nodiscard]] constexpr auto contains(i32 Xpoint, i32 Ypoint) const -> bool {
+        return Xpoint >= Xstart && Xpoint <= Xend && Ypoint >= Ystart && Ypoint <= Yend;
+    }
+
+    [[nodiscard]] constexpr auto operator==(const Rect &other) const -> bool = default;
+
+    /// Overlapping part of both rectangles, may be empty
+    [[nodiscard]] constexpr auto intersect(const Rect &other) const -> Rect {
+        return {std::max(Xstart, other.Xstart),
+                std::max(Ystart, other.Ystart),
+                std::min(Xend, other.Xend),
+                std::min(Yend, other.Yend)};
+    }
+
+    /// Bounding box of both rectangles, an empty side is ignored
+    [[nodiscard]] constexpr auto unite(const Rect &other) const -> Rect {
+        if (empty()) return other;
+        if (other.empty()) return *this;
+        return {std::min(Xstart, other.Xstart),
+                std::min(Ystart, other.Ystart),
+                std::max(Xend, other.Xend),
+                std::max(Yend, other.Yend)};
+    }
+};
+
+}  // namespace pico_oled
+
+#endif
@@ -0,0 +1,105 @@
+#ifndef __PICO_OLED_SIGNAL_PLOT_HPP
+#define __PICO_OLED_SIGNAL_PLOT_HPP
+
+#include <array>
+#include <span>
+
+#include "dirty_rects.hpp"
+#include "imbuf.hpp"
+#include "paint.hpp"
+#include "paint_enums.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+namespace pico_oled::paint {
+
+/// Most columns a plot keeps, a plot across the long side of the panel
+static constexpr u16 k_plot_columns = k_width > k_height ? k_width : k_height;
+
+/// Scrolling time-series plot of a fast signal, e.g. an ADC sampled at many kHz
+///
+/// Every `Samples_per_column` samples are reduced to the range they cover and become one
+/// column, drawn as a vertical span from their minimum to their maximum. The last columns are
+/// kept in a ring buffer, so adding a sample costs a compare and a count however fast samples
+/// arrive, and drawing is independent of the sample rate. `draw` scrolls the plot left by the
+/// columns completed since the last frame and draws only those.
+///
+/// Spans of neighbouring columns are stretched until they touch, so steep edges stay connected.
+struct SignalPlot {
+   private:
+    /// Rows of a column relative to the top of the plot, `top` <= `bottom`
+    struct Column {
+        u8 top;
+        u8 bottom;
+    };
+
+    Rect m_area;
+    i32 m_min;
+    i32 m_max;
+    u16 m_samples_per_column;
+    eImageColors m_foreground;
+    eImageColors m_background;
+    /// The last columns, the newest one just before `m_head`
+    std::array<Column, k_plot_columns> m_columns;
+    u16 m_head;
+    u16 m_count;
+    /// Columns completed since the last `draw`
+    u16 m_pending;
+    /// Range and number of the samples of the column being collected
+    i32 m_low;
+    i32 m_high;
+    u16 m_taken;
+    bool m_valid;
+
+    /// Row of `Value` relative to the top of the plot, `m_max` on top
+    auto row(i32 Value) const -> u8;
+
+    /// Turns the collected samples into a column
+    auto push_column() -> void;
+
+    /// Column `Age` columns older than the newest one
+    auto column(u16 Age) const -> Column;
+
+    /// Draws the column `Age` at `Xpoint`, stretched towards the column before it
+    auto draw_column(Paint &paint, u16 Age, i32 Xpoint) const -> void;
+
+   public:
+    /// Plot filling `Area`, mapping `Min` to its bottom and `Max` to its top row. The area is
+    /// cut to `k_plot_columns` wide and 256 high.
+    SignalPlot(const Rect &Area,
+               i32 Min,
+               i32 Max,
+               u16 Samples_per_column,
+               eImageColors Color_Foreground,
+               eImageColors Color_Background);
+
+    /// Adds one sample, values outside `Min`..`Max` are drawn at the edge
+    auto add(i32 Sample) -> void {
+        this->m_low = Sample < this->m_low ? Sample : this->m_low;
+        this->m_high = Sample > this->m_high ? Sample : this->m_high;
+        if (++this->m_taken == this->m_samples_per_column) this->push_column();
+    }
+
+    /// Adds a block of samples, e.g. a DMA buffer of ADC readings
+    auto add(std::span<const u16> Samples) -> void;
+
+    /// Draws the columns completed since the last call, scrolling the older ones left, and adds
+    /// the changed area to `Dirty`.
+    ///
+    /// Returns false if nothing had to be drawn.
+    auto draw(Paint &paint, DirtyRects &Dirty) -> bool;
+
+    /// Forgets all columns and the samples collected so far, the plot is blank on the next
+    /// `draw`
+    auto clear() -> void;
+
+    /// Redraws the whole plot on the next `draw`, e.g. after the image was cleared
+    auto invalidate() -> void;
+
+    /// Area covered by the plot
+    auto bounds() const -> Rect;
+};
+
+}  // namespace pico_oled::paint
+
+#endif
@@ -0,0 +1,94 @@
+#ifndef __PICO_OLED_SPECTRUM_BARS_HPP
+#define __PICO_OLED_SPECTRUM_BARS_HPP
+
+#include <array>
+#include <span>
+
+#include "dirty_rects.hpp"
+#include "fft_q15.hpp"
+#include "paint.hpp"
+#include "paint_enums.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+namespace pico_oled::paint {
+
+/// Most bars a spectrum can have
+static constexpr u8 k_spectrum_bars = 32;
+
+/// Frames a peak marker stays put before it starts falling, a pixel per frame
+static constexpr u8 k_peak_hold_frames = 15;
+
+/// Spectrum analyser, a block of samples drawn as bars with falling peak markers
+///
+/// `update` windows the block, runs `dsp::fft` on it and sorts the bins into bars spaced
+/// evenly in log frequency, so every octave gets about the same width. A bar shows the loudest
+/// of its bins in log magnitude, from `k_spectrum_floor` to `k_spectrum_ceiling`. All buffers
+/// are members, nothing is allocated.
+///
+/// `draw` only touches the rows of the bars that changed since the last frame.
+struct SpectrumBars {
+   private:
+    /// Height of the bar and its peak marker, in pixels
+    struct Bar {
+        u8 level;
+        u8 peak;
+    };
+
+    Rect m_area;
+    u16 m_points;
+    u8 m_bars;
+    eImageColors m_foreground;
+    eImageColors m_background;
+    /// First bin of every bar, and one past the bins of the last one
+    std::array<u8, k_spectrum_bars + 1> m_edges;
+    std::array<i16, dsp::k_fft_max_points> m_real;
+    std::array<i16, dsp::k_fft_max_points> m_imag;
+    std::array<u16, dsp::k_fft_max_points / 2> m_magnitudes;
+    std::array<Bar, k_spectrum_bars> m_shown;
+    std::array<Bar, k_spectrum_bars> m_drawn;
+    /// Frames left before each peak marker falls
+    std::array<u8, k_spectrum_bars> m_hold;
+    bool m_valid;
+
+    /// Height of a bar for `Magnitude`
+    auto level(u16 Magnitude) const -> u8;
+
+    /// Draws the rows of bar `Index` that differ from what was drawn before, or all of them if
+    /// `Whole`. Returns false if there were none.
+    auto draw_bar(Paint &paint, u8 Index, bool Whole, DirtyRects &Dirty) -> bool;
+
+   public:
+    /// `log2` of the magnitudes at the bottom and top of the bars, in 8.8 fixed point. A full
+    /// scale sine comes out of the Hann window and the FFT at a quarter of full scale.
+    static constexpr u16 k_spectrum_floor = 3 << 8;
+    static constexpr u16 k_spectrum_ceiling = 13 << 8;
+
+    /// Spectrum of `Points` samples as `Bars` bars filling `Area`, one pixel apart. `Points` is
+    /// rounded down to a power of two from 4 to `dsp::k_fft_max_points`, `Bars` is cut to
+    /// `k_spectrum_bars` and to the bins there are, the area to 255 rows.
+    SpectrumBars(const Rect &Area,
+                 u8 Bars,
+                 u16 Points,
+                 eImageColors Color_Foreground,
+                 eImageColors Color_Background);
+
+    /// Analyses a new block of samples and moves the peak markers, call it once per frame.
+    /// Missing samples count as silence, extra ones are ignored.
+    auto update(std::span<const i16> Samples) -> void;
+
+    /// Draws the bars that changed since the last call and adds them to `Dirty`
+    ///
+    /// Returns false if nothing had to be drawn.
+    auto draw(Paint &paint, DirtyRects &Dirty) -> bool;
+
+    /// Redraws the whole spectrum on the next `draw`, e.g. after the image was cleared
+    auto invalidate() -> void;
+
+    /// Area covered by the bars
+    auto bounds() const -> Rect;
+};
+
+}  // namespace pico_oled::paint
+
+#endif
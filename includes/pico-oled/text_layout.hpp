@@ -0,0 +1,81 @@
+#ifndef __PICO_OLED_TEXT_LAYOUT_HPP
+#define __PICO_OLED_TEXT_LAYOUT_HPP
+
+#include <cstddef>
+#include <string_view>
+
+#include "types.hpp"
+
+namespace pico_oled::text {
+
+/// One line of laid out text
+struct TextLine {
+    /// Characters on the line, without the break that ended it
+    std::string_view text;
+    /// Pixels from the left edge of the first glyph to the right edge of the last one
+    i32 width;
+};
+
+/// Extents of a laid out text
+struct TextSize {
+    /// Pixels of the widest line
+    i32 width;
+    i32 height;
+    u16 lines;
+};
+
+/// Pixels taken by `Count` characters of a fixed-width font advancing `Advance` pixels each
+constexpr auto run_width(std::size_t Count, i32 Advance) -> i32 {
+    return static_cast<i32>(Count) * Advance;
+}
+
+/// Cuts the next line off `Rest` and returns it.
+///
+/// A line ends at a '\n' or, if `Max_width` is positive, at the last space that keeps it within
+/// `Max_width` pixels. A word wider than a line on its own is broken where it overflows, a line
+/// always keeps at least one character. The spaces at a wrap are dropped.
+constexpr auto next_line(std::string_view &Rest, i32 Advance, i32 Max_width) -> TextLine {
+    const std::size_t newline = Rest.find('\n');
+    std::string_view line = Rest.substr(0, newline);
+
+    std::size_t fits = line.size();
+    if (Max_width > 0 && Advance > 0)
+        fits = static_cast<std::size_t>(Max_width >= Advance ? Max_width / Advance : 1);
+    if (line.size() <= fits) {
+        Rest = newline == std::string_view::npos ? std::string_view{} : Rest.substr(newline + 1);
+        return {line, run_width(line.size(), Advance)};
+    }
+
+    // Break at the last space within the line, or within the word if there is none
+    const std::size_t space = line.rfind(' ', fits);
+    std::size_t end = space != std::string_view::npos && space > 0 ? space : fits;
+    std::size_t next = end;
+    while (next < Rest.size() && Rest[next] == ' ') next++;
+    while (end > 0 && line[end - 1] == ' ') end--;
+
+    line = line.substr(0, end > 0 ? end : fits);
+    Rest = Rest.substr(end > 0 ? next : fits);
+    return {line, run_width(line.size(), Advance)};
+}
+
+/// Size of `Text` in a fixed-width font `Scale` times magnified, laid out by `next_line` to
+/// lines of at most `Max_width` pixels. A `Max_width` of 0 only breaks at '\n'.
+template <typename FontT>
+constexpr auto measure_text(std::string_view Text,
+                            const FontT &Font,
+                            i32 Max_width = 0,
+                            u8 Scale = 1) -> TextSize {
+    const i32 Advance = Font.Width * Scale;
+    TextSize size = {0, 0, 0};
+    while (!Text.empty()) {
+        const TextLine line = next_line(Text, Advance, Max_width);
+        size.width = line.width > size.width ? line.width : size.width;
+        size.lines++;
+    }
+    size.height = size.lines * Font.Height * Scale;
+    return size;
+}
+
+}  // namespace pico_oled::text
+
+#endif
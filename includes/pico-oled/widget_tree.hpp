@@ -0,0 +1,163 @@
+#ifndef __PICO_OLED_WIDGET_TREE_HPP
+#define __PICO_OLED_WIDGET_TREE_HPP
+
+#include <array>
+#include <string_view>
+
+#include "dirty_rects.hpp"
+#include "fonts.hpp"
+#include "paint.hpp"
+#include "paint_enums.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+namespace pico_oled::paint {
+
+/// Most widgets a tree holds
+static constexpr u8 k_max_widgets = 32;
+
+/// Index of a widget in its tree
+using WidgetId = u8;
+
+/// Parent of top level widgets, and what `add_*` returns once the tree is full
+static constexpr WidgetId k_no_widget = 0xFF;
+
+/// What a widget draws
+enum class eWidgetKind : u8 { LABEL, NUMBER, BAR, ICON, RECTANGLE };
+
+/// Retained-mode screen, a fixed tree of widgets that redraws only what changed
+///
+/// Widgets are added once, each placed relative to its parent, and then changed through the
+/// setters, which only note what changed. `render` works out the areas that differ from the
+/// last frame, both where changed widgets are now and where they were before, merged into a
+/// `DirtyRects`. Every area is cleared to the background and each visible widget overlapping
+/// it is drawn again, clipped to the area, in the order the widgets were added. Widgets added
+/// later are on top, so a child covers its parent.
+///
+/// Hiding or moving a widget does the same to its children. Nothing is allocated, label texts
+/// are kept as views and have to outlive the tree, e.g. string literals.
+struct WidgetTree {
+   private:
+    struct Widget {
+        eWidgetKind kind;
+        WidgetId parent;
+        bool visible;
+        /// Content changed since the last `render`
+        bool changed;
+        eImageColors foreground;
+        eImageColors background;
+        /// Area relative to the parent's top left corner
+        Rect box;
+        /// Area on screen at the last `render`, empty if it was not shown
+        Rect drawn;
+        /// Labels and numbers
+        const font::Font *font;
+        std::string_view text;
+        eTextAlign align;
+        /// Icons, `src_stride` bytes per bitmap row
+        const u8 *src;
+        u16 src_stride;
+        /// Numbers and bars, numbers show `value / 10^decimals`
+        i32 value;
+        i32 min;
+        i32 max;
+        u8 decimals;
+        /// Rectangles, only the outline otherwise
+        bool filled;
+    };
+
+    std::array<Widget, k_max_widgets> m_widgets;
+    u8 m_count;
+    eImageColors m_background;
+    /// Clear the whole image on the next `render`
+    bool m_whole;
+
+    /// Appends a widget, returns `k_no_widget` if the tree is full or the parent is unknown
+    auto add(const Widget &widget) -> WidgetId;
+
+    /// Area on screen of widget `Id`, empty if it or any of its parents is hidden
+    auto screen_rect(WidgetId Id) const -> Rect;
+
+    /// Draws `widget` at `Area`, the caller has clipped to the part to redraw
+    auto draw_widget(Paint &paint, const Widget &widget, const Rect &Area) const -> void;
+
+    auto valid(WidgetId Id) const -> bool { return Id < this->m_count; }
+
+   public:
+    /// Empty tree on a screen of `Color_Background`
+    explicit WidgetTree(eImageColors Color_Background);
+
+    /// Text laid out in `Box` like `Paint::draw_text`
+    auto add_label(WidgetId Parent,
+                   const Rect &Box,
+                   std::string_view Text,
+                   const font::Font &Font,
+                   eImageColors Color_Foreground,
+                   eImageColors Color_Background,
+                   eTextAlign Align = eTextAlign::ALIGN_LEFT) -> WidgetId;
+
+    /// Fixed-point number `Value / 10^Decimals`, right aligned in `Box`
+    auto add_number(WidgetId Parent,
+                    const Rect &Box,
+                    i32 Value,
+                    const font::Font &Font,
+                    eImageColors Color_Foreground,
+                    eImageColors Color_Background,
+                    u8 Decimals = 0) -> WidgetId;
+
+    /// Outlined horizontal bar filled from the left in proportion to `Value` in `Min`..`Max`
+    auto add_bar(WidgetId Parent,
+                 const Rect &Box,
+                 i32 Value,
+                 i32 Min,
+                 i32 Max,
+                 eImageColors Color_Foreground,
+                 eImageColors Color_Background) -> WidgetId;
+
+    /// 1 bpp bitmap of `Width` x `Height` pixels, drawn like `Paint::draw_mask`
+    auto add_icon(WidgetId Parent,
+                  i32 Xstart,
+                  i32 Ystart,
+                  const u8 *src,
+                  u16 src_stride,
+                  u16 Width,
+                  u16 Height,
+                  eImageColors Color_Foreground,
+                  eImageColors Color_Background) -> WidgetId;
+
+    /// Rectangle in `Color`, filled or a one pixel outline. Also serves as a frame to group
+    /// other widgets under.
+    auto add_rectangle(WidgetId Parent, const Rect &Box, eImageColors Color, bool Filled)
+        -> WidgetId;
+
+    /// Changes the text of a label
+    auto set_text(WidgetId Id, std::string_view Text) -> void;
+
+    /// Changes the value of a number or a bar
+    auto set_value(WidgetId Id, i32 Value) -> void;
+
+    /// Shows or hides a widget and its children
+    auto set_visible(WidgetId Id, bool Visible) -> void;
+
+    /// Moves a widget and its children, (`Xstart`, `Ystart`) is relative to its parent
+    auto move_to(WidgetId Id, i32 Xstart, i32 Ystart) -> void;
+
+    auto set_colors(WidgetId Id, eImageColors Color_Foreground, eImageColors Color_Background)
+        -> void;
+
+    /// Redraws what changed since the last call and adds it to `Dirty`
+    ///
+    /// Returns false if nothing had to be drawn.
+    auto render(Paint &paint, DirtyRects &Dirty) -> bool;
+
+    /// Clears the whole image to the background and redraws every widget on the next `render`,
+    /// e.g. after something else was drawn over the screen
+    auto invalidate() -> void;
+
+    /// Area of widget `Id` on screen, empty if it is hidden
+    auto bounds(WidgetId Id) const -> Rect;
+};
+
+}  // namespace pico_oled::paint
+
+#endif
@@ -0,0 +1,343 @@
+#include "buffer_ops.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+#include "buffer_kernels.hpp"
+#include "imbuf.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+using namespace pico_oled;
+using namespace pico_oled::buffer;
+
+namespace {
+
+/// A buffer word, may alias the bytes of an `ImBuf`
+using Word [[gnu::may_alias]] = u32;
+
+/// Applies `word_op` to every whole word within the first `Bytes` bytes and `byte_op` to the
+/// bytes left over
+template <typename WordOp, typename ByteOp>
+auto for_words(u8 *dst, u32 Bytes, WordOp word_op, ByteOp byte_op) -> void {
+    Word *out = reinterpret_cast<Word *>(dst);
+    const u32 count = Bytes / 4;
+    for (u32 i = 0; i < count; i++) word_op(out[i], i);
+    for (u32 i = count * 4; i < Bytes; i++) byte_op(dst[i], i);
+}
+
+auto words(const u8 *src) -> const Word * { return reinterpret_cast<const Word *>(src); }
+
+auto scalar_fill(u8 *dst, u8 Value, u32 Bytes) -> void {
+    const u32 pattern = Value * 0x01010101u;
+    for_words(
+        dst, Bytes, [&](Word &w, u32) { w = pattern; }, [&](u8 &b, u32) { b = Value; });
+}
+
+auto scalar_invert(u8 *dst, u32 Bytes) -> void {
+    for_words(
+        dst,
+        Bytes,
+        [](Word &w, u32) { w = ~w; },
+        [](u8 &b, u32) { b = static_cast<u8>(~b); });
+}
+
+auto scalar_copy(u8 *dst, const u8 *src, u32 Bytes) -> void {
+    const Word *in = words(src);
+    for_words(
+        dst, Bytes, [&](Word &w, u32 i) { w = in[i]; }, [&](u8 &b, u32 i) { b = src[i]; });
+}
+
+auto scalar_and_with(u8 *dst, const u8 *src, u32 Bytes) -> void {
+    const Word *in = words(src);
+    for_words(
+        dst,
+        Bytes,
+        [&](Word &w, u32 i) { w &= in[i]; },
+        [&](u8 &b, u32 i) { b = static_cast<u8>(b & src[i]); });
+}
+
+auto scalar_or_with(u8 *dst, const u8 *src, u32 Bytes) -> void {
+    const Word *in = words(src);
+    for_words(
+        dst,
+        Bytes,
+        [&](Word &w, u32 i) { w |= in[i]; },
+        [&](u8 &b, u32 i) { b = static_cast<u8>(b | src[i]); });
+}
+
+auto scalar_xor_with(u8 *dst, const u8 *src, u32 Bytes) -> void {
+    const Word *in = words(src);
+    for_words(
+        dst,
+        Bytes,
+        [&](Word &w, u32 i) { w ^= in[i]; },
+        [&](u8 &b, u32 i) { b = static_cast<u8>(b ^ src[i]); });
+}
+
+auto scalar_blend(u8 *dst, const u8 *src, const u8 *mask, u32 Bytes) -> void {
+    const Word *in = words(src);
+    const Word *sel = words(mask);
+    // Flips the bits of `dst` that differ from `src`, where the mask is lit
+    for_words(
+        dst,
+        Bytes,
+        [&](Word &w, u32 i) { w ^= (w ^ in[i]) & sel[i]; },
+        [&](u8 &b, u32 i) { b = static_cast<u8>(b ^ ((b ^ src[i]) & mask[i])); });
+}
+
+/// Transposes one 8x8 tile in two words, see Hacker's Delight 7-3
+auto transpose_tile(const u8 *src, u32 src_stride, u8 *dst, u32 dst_stride) -> void {
+    u32 x = static_cast<u32>(src[0]) << 24 | static_cast<u32>(src[src_stride]) << 16 |
+            static_cast<u32>(src[2 * src_stride]) << 8 | src[3 * src_stride];
+    u32 y = static_cast<u32>(src[4 * src_stride]) << 24 |
+            static_cast<u32>(src[5 * src_stride]) << 16 |
+            static_cast<u32>(src[6 * src_stride]) << 8 | src[7 * src_stride];
+
+    // Swaps bits across the diagonal of 2x2, 4x4 and then 8x8 blocks
+    u32 t = (x ^ (x >> 7)) & 0x00AA00AAu;
+    x = x ^ t ^ (t << 7);
+    t = (y ^ (y >> 7)) & 0x00AA00AAu;
+    y = y ^ t ^ (t << 7);
+    t = (x ^ (x >> 14)) & 0x0000CCCCu;
+    x = x ^ t ^ (t << 14);
+    t = (y ^ (y >> 14)) & 0x0000CCCCu;
+    y = y ^ t ^ (t << 14);
+    t = (x & 0xF0F0F0F0u) | ((y >> 4) & 0x0F0F0F0Fu);
+    y = ((x << 4) & 0xF0F0F0F0u) | (y & 0x0F0F0F0Fu);
+    x = t;
+
+    for (u32 i = 0; i < 4; i++) {
+        dst[i * dst_stride] = static_cast<u8>(x >> (24 - 8 * i));
+        dst[(i + 4) * dst_stride] = static_cast<u8>(y >> (24 - 8 * i));
+    }
+}
+
+auto scalar_transpose(
+    const u8 *src, u32 src_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height) -> void {
+    for (u32 Y = 0; Y + 8 <= Height; Y += 8) {
+        for (u32 X = 0; X + 8 <= Width; X += 8) {
+            transpose_tile(src + Y * src_stride + X / 8, src_stride, dst + X * dst_stride + Y / 8,
+                           dst_stride);
+        }
+    }
+}
+
+auto scalar_dither(
+    const u8 *gray, u32 gray_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height) -> void {
+    for (u32 Y = 0; Y < Height; Y++) {
+        const std::array<u8, 8> &thresholds = k_dither_thresholds[Y % 8];
+        const u8 *in = gray + Y * gray_stride;
+        u8 *out = dst + Y * dst_stride;
+        for (u32 X = 0; X < Width; X += 8) {
+            const u32 count = std::min<u32>(8, Width - X);
+            u32 bits = 0;
+            for (u32 i = 0; i < count; i++) {
+                if (in[X + i] > thresholds[i]) bits |= 0x80u >> i;
+            }
+            out[X / 8] = static_cast<u8>(bits);
+        }
+    }
+}
+
+auto scalar_diff(const u8 *prev, const u8 *next) -> Rect {
+    constexpr u32 row_words = k_row_bytes / 4;
+    const Word *a = words(prev);
+    const Word *b = words(next);
+    std::array<u32, row_words> columns = {};
+    i32 first_row = k_height;
+    i32 last_row = -1;
+    for (i32 Y = 0; Y < k_height; Y++) {
+        u32 changed = 0;
+        for (u32 i = 0; i < row_words; i++) {
+            const u32 bits = a[static_cast<u32>(Y) * row_words + i] ^
+                             b[static_cast<u32>(Y) * row_words + i];
+            columns[i] |= bits;
+            changed |= bits;
+        }
+        if (changed != 0) {
+            first_row = std::min(first_row, Y);
+            last_row = Y;
+        }
+    }
+
+    // The words were ORed as they lie in memory, so their bytes are still in buffer order
+    std::array<u8, k_row_bytes> column_bytes = {};
+    std::memcpy(column_bytes.data(), columns.data(), k_row_bytes);
+    return diff_bounds(column_bytes.data(), first_row, last_row);
+}
+
+/// Mirrors `Rows` rows of `Row_words` words each left to right. Both words of a pair are read
+/// before either is written, so `dst` may be `src`.
+auto mirror_rows(u8 *dst, const u8 *src, u32 Row_words, u32 Rows) -> void {
+    Word *out = reinterpret_cast<Word *>(dst);
+    const Word *in = words(src);
+    for (u32 row = 0; row < Rows; row++) {
+        const u32 first = row * Row_words;
+        for (u32 i = 0; i < (Row_words + 1) / 2; i++) {
+            // Reversing all bits of a little endian word also reverses its bytes
+            const u32 left = in[first + i];
+            const u32 right = in[first + Row_words - 1 - i];
+            out[first + i] = reverse_bits(right);
+            out[first + Row_words - 1 - i] = reverse_bits(left);
+        }
+    }
+}
+
+/// Reverses the order of `Rows` rows of `Row_words` words each, `dst` may be `src`
+auto mirror_columns(u8 *dst, const u8 *src, u32 Row_words, u32 Rows) -> void {
+    Word *out = reinterpret_cast<Word *>(dst);
+    const Word *in = words(src);
+    for (u32 row = 0; row < (Rows + 1) / 2; row++) {
+        const u32 top = row * Row_words;
+        const u32 bottom = (Rows - 1 - row) * Row_words;
+        for (u32 i = 0; i < Row_words; i++) {
+            const u32 upper = in[top + i];
+            const u32 lower = in[bottom + i];
+            out[top + i] = lower;
+            out[bottom + i] = upper;
+        }
+    }
+}
+
+static_assert(k_width % 32 == 0 && k_height % 32 == 0, "turned rows must be whole words too");
+constexpr u32 k_row_words = k_width / 32;
+constexpr u32 k_turned_row_words = k_height / 32;
+
+#ifdef PICO_OLED_X86_KERNELS
+const Kernels *g_kernels = nullptr;
+
+/// Best backend of the CPU, SSE2 is part of x86-64
+auto detect() -> const Kernels * {
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2")) return &k_avx2_kernels;
+    return &k_sse2_kernels;
+}
+
+auto kernels() -> const Kernels & {
+    if (g_kernels == nullptr) g_kernels = detect();
+    return *g_kernels;
+}
+#else
+/// Without other backends the table is constant and its calls are direct
+auto kernels() -> const Kernels & { return k_scalar_kernels; }
+#endif
+
+}  // namespace
+
+// Declared extern in buffer_kernels.hpp, a constexpr variable alone has internal linkage
+constexpr Kernels pico_oled::buffer::k_scalar_kernels = {
+    .fill = scalar_fill,
+    .invert = scalar_invert,
+    .copy = scalar_copy,
+    .and_with = scalar_and_with,
+    .or_with = scalar_or_with,
+    .xor_with = scalar_xor_with,
+    .blend = scalar_blend,
+    .transpose = scalar_transpose,
+    .dither = scalar_dither,
+    .diff = scalar_diff,
+};
+
+auto buffer::backend() -> eKernelBackend {
+#ifdef PICO_OLED_X86_KERNELS
+    const Kernels *current = &kernels();
+    if (current == &k_avx2_kernels) return eKernelBackend::AVX2;
+    if (current == &k_sse2_kernels) return eKernelBackend::SSE2;
+#endif
+    return eKernelBackend::SCALAR;
+}
+
+auto buffer::use_backend(eKernelBackend Backend) -> bool {
+#ifdef PICO_OLED_X86_KERNELS
+    __builtin_cpu_init();
+    switch (Backend) {
+        case eKernelBackend::SCALAR:
+            g_kernels = &k_scalar_kernels;
+            return true;
+        case eKernelBackend::SSE2:
+            g_kernels = &k_sse2_kernels;
+            return true;
+        case eKernelBackend::AVX2:
+            if (!__builtin_cpu_supports("avx2")) return false;
+            g_kernels = &k_avx2_kernels;
+            return true;
+    }
+    return false;
+#else
+    return Backend == eKernelBackend::SCALAR;
+#endif
+}
+
+auto buffer::fill(ImBuf &dst, u8 Value, u32 Bytes) -> void {
+    kernels().fill(dst.data(), Value, std::min(Bytes, k_imsize));
+}
+
+auto buffer::invert(ImBuf &dst, u32 Bytes) -> void {
+    kernels().invert(dst.data(), std::min(Bytes, k_imsize));
+}
+
+auto buffer::copy(ImBuf &dst, const ImBuf &src, u32 Bytes) -> void {
+    kernels().copy(dst.data(), src.data(), std::min(Bytes, k_imsize));
+}
+
+auto buffer::and_with(ImBuf &dst, const ImBuf &src, u32 Bytes) -> void {
+    kernels().and_with(dst.data(), src.data(), std::min(Bytes, k_imsize));
+}
+
+auto buffer::or_with(ImBuf &dst, const ImBuf &src, u32 Bytes) -> void {
+    kernels().or_with(dst.data(), src.data(), std::min(Bytes, k_imsize));
+}
+
+auto buffer::xor_with(ImBuf &dst, const ImBuf &src, u32 Bytes) -> void {
+    kernels().xor_with(dst.data(), src.data(), std::min(Bytes, k_imsize));
+}
+
+auto buffer::blend(ImBuf &dst, const ImBuf &src, const ImBuf &mask, u32 Bytes) -> void {
+    kernels().blend(dst.data(), src.data(), mask.data(), std::min(Bytes, k_imsize));
+}
+
+auto buffer::transpose(
+    const u8 *src, u32 src_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height) -> void {
+    kernels().transpose(src, src_stride, dst, dst_stride, Width & ~7u, Height & ~7u);
+}
+
+auto buffer::dither(
+    const u8 *gray, u32 gray_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height) -> void {
+    kernels().dither(gray, gray_stride, dst, dst_stride, Width, Height);
+}
+
+auto buffer::flip_horizontal(ImBuf &dst, const ImBuf &src) -> void {
+    mirror_rows(dst.data(), src.data(), k_row_words, k_height);
+}
+
+auto buffer::flip_horizontal(ImBuf &buf) -> void { flip_horizontal(buf, buf); }
+
+auto buffer::flip_vertical(ImBuf &dst, const ImBuf &src) -> void {
+    mirror_columns(dst.data(), src.data(), k_row_words, k_height);
+}
+
+auto buffer::flip_vertical(ImBuf &buf) -> void { flip_vertical(buf, buf); }
+
+auto buffer::rotate_180(ImBuf &dst, const ImBuf &src) -> void {
+    // Mirroring the whole buffer as one row mirrors the rows and their order at once
+    mirror_rows(dst.data(), src.data(), k_imsize / 4, 1);
+}
+
+auto buffer::rotate_180(ImBuf &buf) -> void { rotate_180(buf, buf); }
+
+auto buffer::rotate_90(ImBuf &dst, const ImBuf &src) -> void {
+    // Mirrored at the diagonal, pixel (x, y) is at (y, x), the rows then turn it clockwise
+    kernels().transpose(src.data(), k_width / 8, dst.data(), k_height / 8, k_width, k_height);
+    mirror_rows(dst.data(), dst.data(), k_turned_row_words, k_width);
+}
+
+auto buffer::rotate_270(ImBuf &dst, const ImBuf &src) -> void {
+    kernels().transpose(src.data(), k_width / 8, dst.data(), k_height / 8, k_width, k_height);
+    mirror_columns(dst.data(), dst.data(), k_turned_row_words, k_width);
+}
+
+auto buffer::diff(const ImBuf &Prev, const ImBuf &Next) -> Rect {
+    return kernels().diff(Prev.data(), Next.data());
+}
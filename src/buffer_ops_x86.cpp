@@ -0,0 +1,396 @@
+// SSE2 and AVX2 versions of the buffer kernels, only built for x86-64 hosts
+//
+// The AVX2 functions carry a target attribute instead of the whole file being built with
+// -mavx2, so nothing shared with the rest of the program can pick up instructions an older CPU
+// lacks. `buffer_ops.cpp` only hands them out after checking the CPU.
+//
+// The AVX2 kernels leave what is left over to the SSE2 ones, and clear the upper halves of the
+// vector registers first: SSE instructions after AVX ones with dirty upper halves stall.
+
+#include <immintrin.h>
+
+#include <array>
+#include <bit>
+
+#include "buffer_kernels.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+using namespace pico_oled;
+using namespace pico_oled::buffer;
+
+namespace {
+
+// Lane operations of the two-buffer kernels, the same ones the scalar kernels do per word
+
+struct And {
+    static auto apply(__m128i d, __m128i s) -> __m128i { return _mm_and_si128(d, s); }
+    [[gnu::target("avx2")]] static auto apply(__m256i d, __m256i s) -> __m256i {
+        return _mm256_and_si256(d, s);
+    }
+    static auto scalar(u8 *dst, const u8 *src, u32 Bytes) -> void {
+        k_scalar_kernels.and_with(dst, src, Bytes);
+    }
+};
+
+struct Or {
+    static auto apply(__m128i d, __m128i s) -> __m128i { return _mm_or_si128(d, s); }
+    [[gnu::target("avx2")]] static auto apply(__m256i d, __m256i s) -> __m256i {
+        return _mm256_or_si256(d, s);
+    }
+    static auto scalar(u8 *dst, const u8 *src, u32 Bytes) -> void {
+        k_scalar_kernels.or_with(dst, src, Bytes);
+    }
+};
+
+struct Xor {
+    static auto apply(__m128i d, __m128i s) -> __m128i { return _mm_xor_si128(d, s); }
+    [[gnu::target("avx2")]] static auto apply(__m256i d, __m256i s) -> __m256i {
+        return _mm256_xor_si256(d, s);
+    }
+    static auto scalar(u8 *dst, const u8 *src, u32 Bytes) -> void {
+        k_scalar_kernels.xor_with(dst, src, Bytes);
+    }
+};
+
+struct Copy {
+    static auto apply(__m128i, __m128i s) -> __m128i { return s; }
+    [[gnu::target("avx2")]] static auto apply(__m256i, __m256i s) -> __m256i { return s; }
+    static auto scalar(u8 *dst, const u8 *src, u32 Bytes) -> void {
+        k_scalar_kernels.copy(dst, src, Bytes);
+    }
+};
+
+auto load16(const u8 *p) -> __m128i {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+auto store(u8 *p, __m128i v) -> void { _mm_storeu_si128(reinterpret_cast<__m128i *>(p), v); }
+
+[[gnu::target("avx2")]] auto load32(const u8 *p) -> __m256i {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+}
+
+[[gnu::target("avx2")]] auto store(u8 *p, __m256i v) -> void {
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), v);
+}
+
+/// Bytes compared without sign, 0xFF where `a` is greater than `b`
+auto greater(__m128i a, __m128i b) -> __m128i {
+    const __m128i sign = _mm_set1_epi8(static_cast<char>(0x80));
+    return _mm_cmpgt_epi8(_mm_xor_si128(a, sign), _mm_xor_si128(b, sign));
+}
+
+[[gnu::target("avx2")]] auto greater(__m256i a, __m256i b) -> __m256i {
+    const __m256i sign = _mm256_set1_epi8(static_cast<char>(0x80));
+    return _mm256_cmpgt_epi8(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+}
+
+/// Dither thresholds of row `Y`, repeated across the vector
+auto thresholds128(u32 Y) -> __m128i {
+    return _mm_set1_epi64x(static_cast<long long>(
+        std::bit_cast<u64>(k_dither_thresholds[Y % 8])));
+}
+
+[[gnu::target("avx2")]] auto thresholds256(u32 Y) -> __m256i {
+    return _mm256_set1_epi64x(static_cast<long long>(
+        std::bit_cast<u64>(k_dither_thresholds[Y % 8])));
+}
+
+// SSE2
+
+auto sse2_fill(u8 *dst, u8 Value, u32 Bytes) -> void {
+    const __m128i pattern = _mm_set1_epi8(static_cast<char>(Value));
+    u32 i = 0;
+    for (; i + 16 <= Bytes; i += 16) store(dst + i, pattern);
+    k_scalar_kernels.fill(dst + i, Value, Bytes - i);
+}
+
+auto sse2_invert(u8 *dst, u32 Bytes) -> void {
+    const __m128i ones = _mm_set1_epi8(-1);
+    u32 i = 0;
+    for (; i + 16 <= Bytes; i += 16) store(dst + i, _mm_xor_si128(load16(dst + i), ones));
+    k_scalar_kernels.invert(dst + i, Bytes - i);
+}
+
+template <typename Op>
+auto sse2_combine(u8 *dst, const u8 *src, u32 Bytes) -> void {
+    u32 i = 0;
+    for (; i + 16 <= Bytes; i += 16) store(dst + i, Op::apply(load16(dst + i), load16(src + i)));
+    Op::scalar(dst + i, src + i, Bytes - i);
+}
+
+auto sse2_blend(u8 *dst, const u8 *src, const u8 *mask, u32 Bytes) -> void {
+    u32 i = 0;
+    for (; i + 16 <= Bytes; i += 16) {
+        const __m128i d = load16(dst + i);
+        const __m128i flip = _mm_and_si128(_mm_xor_si128(d, load16(src + i)), load16(mask + i));
+        store(dst + i, _mm_xor_si128(d, flip));
+    }
+    k_scalar_kernels.blend(dst + i, src + i, mask + i, Bytes - i);
+}
+
+/// Regroups 8 rows `r` of 16 bytes, given bottom row first, into 8 vectors `v` of two byte
+/// columns: the low half of vector `i` is column 2i of all rows, the high half column 2i + 1.
+/// Every byte mask of such a vector is then one pixel column, MSB first.
+auto interleave(const __m128i (&r)[8], __m128i (&v)[8]) -> void {
+    __m128i t[8];
+    for (u32 i = 0; i < 4; i++) {
+        t[2 * i] = _mm_unpacklo_epi8(r[2 * i], r[2 * i + 1]);
+        t[2 * i + 1] = _mm_unpackhi_epi8(r[2 * i], r[2 * i + 1]);
+    }
+    __m128i u[8];
+    for (u32 i = 0; i < 2; i++) {
+        u[4 * i] = _mm_unpacklo_epi16(t[4 * i], t[4 * i + 2]);
+        u[4 * i + 1] = _mm_unpackhi_epi16(t[4 * i], t[4 * i + 2]);
+        u[4 * i + 2] = _mm_unpacklo_epi16(t[4 * i + 1], t[4 * i + 3]);
+        u[4 * i + 3] = _mm_unpackhi_epi16(t[4 * i + 1], t[4 * i + 3]);
+    }
+    for (u32 i = 0; i < 4; i++) {
+        v[2 * i] = _mm_unpacklo_epi32(u[i], u[i + 4]);
+        v[2 * i + 1] = _mm_unpackhi_epi32(u[i], u[i + 4]);
+    }
+}
+
+auto sse2_transpose(
+    const u8 *src, u32 src_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height) -> void {
+    u32 Y = 0;
+    // Bands of 8 rows, 128 pixels of them at a time, the rest of a band in 8x8 tiles
+    for (; Y + 8 <= Height; Y += 8) {
+        const u8 *band = src + Y * src_stride;
+        u32 X = 0;
+        for (; X + 128 <= Width; X += 128) {
+            __m128i rows[8];
+            for (u32 j = 0; j < 8; j++) rows[7 - j] = load16(band + j * src_stride + X / 8);
+            __m128i columns[8];
+            interleave(rows, columns);
+
+            u8 *out = dst + X * dst_stride + Y / 8;
+            for (u32 c = 0; c < 8; c++) {
+                __m128i v = columns[c];
+                u8 *even = out + 16 * c * dst_stride;
+                for (u32 i = 0; i < 8; i++, v = _mm_slli_epi64(v, 1)) {
+                    const auto bits = static_cast<u32>(_mm_movemask_epi8(v));
+                    even[i * dst_stride] = static_cast<u8>(bits);
+                    even[(i + 8) * dst_stride] = static_cast<u8>(bits >> 8);
+                }
+            }
+        }
+        k_scalar_kernels.transpose(
+            band + X / 8, src_stride, dst + X * dst_stride + Y / 8, dst_stride, Width - X, 8);
+    }
+}
+
+auto sse2_dither(
+    const u8 *gray, u32 gray_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height) -> void {
+    const u32 whole = Width & ~15u;
+    for (u32 Y = 0; Y < Height; Y++) {
+        const __m128i thresholds = thresholds128(Y);
+        const u8 *in = gray + Y * gray_stride;
+        u8 *out = dst + Y * dst_stride;
+        for (u32 X = 0; X < whole; X += 16) {
+            const __m128i lit = greater(load16(in + X), thresholds);
+            const u32 bits = reverse_in_bytes(static_cast<u32>(_mm_movemask_epi8(lit)));
+            out[X / 8] = static_cast<u8>(bits);
+            out[X / 8 + 1] = static_cast<u8>(bits >> 8);
+        }
+    }
+    // The pattern repeats every 8 columns, so the rest continues it from column 0
+    if (whole < Width) {
+        k_scalar_kernels.dither(gray + whole, gray_stride, dst + whole / 8, dst_stride,
+                                Width - whole, Height);
+    }
+}
+
+auto sse2_diff(const u8 *prev, const u8 *next) -> Rect {
+    __m128i columns = _mm_setzero_si128();
+    i32 first_row = k_height;
+    i32 last_row = -1;
+    for (i32 Y = 0; Y < k_height; Y++) {
+        const u32 offset = static_cast<u32>(Y) * k_row_bytes;
+        const __m128i bits = _mm_xor_si128(load16(prev + offset), load16(next + offset));
+        columns = _mm_or_si128(columns, bits);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(bits, _mm_setzero_si128())) != 0xFFFF) {
+            first_row = first_row < Y ? first_row : Y;
+            last_row = Y;
+        }
+    }
+
+    std::array<u8, k_row_bytes> column_bytes = {};
+    store(column_bytes.data(), columns);
+    return diff_bounds(column_bytes.data(), first_row, last_row);
+}
+
+// AVX2
+
+[[gnu::target("avx2")]] auto avx2_fill(u8 *dst, u8 Value, u32 Bytes) -> void {
+    const __m256i pattern = _mm256_set1_epi8(static_cast<char>(Value));
+    u32 i = 0;
+    for (; i + 32 <= Bytes; i += 32) store(dst + i, pattern);
+    _mm256_zeroupper();
+    sse2_fill(dst + i, Value, Bytes - i);
+}
+
+[[gnu::target("avx2")]] auto avx2_invert(u8 *dst, u32 Bytes) -> void {
+    const __m256i ones = _mm256_set1_epi8(-1);
+    u32 i = 0;
+    for (; i + 32 <= Bytes; i += 32) store(dst + i, _mm256_xor_si256(load32(dst + i), ones));
+    _mm256_zeroupper();
+    sse2_invert(dst + i, Bytes - i);
+}
+
+template <typename Op>
+[[gnu::target("avx2")]] auto avx2_combine(u8 *dst, const u8 *src, u32 Bytes) -> void {
+    u32 i = 0;
+    for (; i + 32 <= Bytes; i += 32) {
+        const __m256i d = load32(dst + i);
+        store(dst + i, Op::apply(d, load32(src + i)));
+    }
+    _mm256_zeroupper();
+    sse2_combine<Op>(dst + i, src + i, Bytes - i);
+}
+
+[[gnu::target("avx2")]] auto avx2_blend(u8 *dst, const u8 *src, const u8 *mask, u32 Bytes) -> void {
+    u32 i = 0;
+    for (; i + 32 <= Bytes; i += 32) {
+        const __m256i d = load32(dst + i);
+        const __m256i s = load32(src + i);
+        const __m256i m = load32(mask + i);
+        store(dst + i, _mm256_xor_si256(d, _mm256_and_si256(_mm256_xor_si256(d, s), m)));
+    }
+    _mm256_zeroupper();
+    sse2_blend(dst + i, src + i, mask + i, Bytes - i);
+}
+
+/// `interleave` on both halves at once, the low half holding one band and the high half the
+/// next
+[[gnu::target("avx2")]] auto interleave(const __m256i (&r)[8], __m256i (&v)[8]) -> void {
+    __m256i t[8];
+    for (u32 i = 0; i < 4; i++) {
+        t[2 * i] = _mm256_unpacklo_epi8(r[2 * i], r[2 * i + 1]);
+        t[2 * i + 1] = _mm256_unpackhi_epi8(r[2 * i], r[2 * i + 1]);
+    }
+    __m256i u[8];
+    for (u32 i = 0; i < 2; i++) {
+        u[4 * i] = _mm256_unpacklo_epi16(t[4 * i], t[4 * i + 2]);
+        u[4 * i + 1] = _mm256_unpackhi_epi16(t[4 * i], t[4 * i + 2]);
+        u[4 * i + 2] = _mm256_unpacklo_epi16(t[4 * i + 1], t[4 * i + 3]);
+        u[4 * i + 3] = _mm256_unpackhi_epi16(t[4 * i + 1], t[4 * i + 3]);
+    }
+    for (u32 i = 0; i < 4; i++) {
+        v[2 * i] = _mm256_unpacklo_epi32(u[i], u[i + 4]);
+        v[2 * i + 1] = _mm256_unpackhi_epi32(u[i], u[i + 4]);
+    }
+}
+
+[[gnu::target("avx2")]] auto avx2_transpose(
+    const u8 *src, u32 src_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height) -> void {
+    u32 Y = 0;
+    // Two bands of 8 rows at a time, each in one half of the vectors
+    for (; Y + 16 <= Height; Y += 16) {
+        const u8 *band = src + Y * src_stride;
+        u32 X = 0;
+        for (; X + 128 <= Width; X += 128) {
+            __m256i rows[8];
+            for (u32 j = 0; j < 8; j++) {
+                const u8 *row = band + j * src_stride + X / 8;
+                rows[7 - j] = _mm256_inserti128_si256(
+                    _mm256_castsi128_si256(load16(row)), load16(row + 8 * src_stride), 1);
+            }
+            __m256i columns[8];
+            interleave(rows, columns);
+
+            u8 *out = dst + X * dst_stride + Y / 8;
+            for (u32 c = 0; c < 8; c++) {
+                __m256i v = columns[c];
+                u8 *even = out + 16 * c * dst_stride;
+                for (u32 i = 0; i < 8; i++, v = _mm256_slli_epi64(v, 1)) {
+                    const auto bits = static_cast<u32>(_mm256_movemask_epi8(v));
+                    even[i * dst_stride] = static_cast<u8>(bits);
+                    even[i * dst_stride + 1] = static_cast<u8>(bits >> 16);
+                    even[(i + 8) * dst_stride] = static_cast<u8>(bits >> 8);
+                    even[(i + 8) * dst_stride + 1] = static_cast<u8>(bits >> 24);
+                }
+            }
+        }
+        k_scalar_kernels.transpose(
+            band + X / 8, src_stride, dst + X * dst_stride + Y / 8, dst_stride, Width - X, 16);
+    }
+    _mm256_zeroupper();
+    sse2_transpose(src + Y * src_stride, src_stride, dst + Y / 8, dst_stride, Width, Height - Y);
+}
+
+[[gnu::target("avx2")]] auto avx2_dither(
+    const u8 *gray, u32 gray_stride, u8 *dst, u32 dst_stride, u32 Width, u32 Height) -> void {
+    const u32 whole = Width & ~31u;
+    for (u32 Y = 0; Y < Height; Y++) {
+        const __m256i thresholds = thresholds256(Y);
+        const u8 *in = gray + Y * gray_stride;
+        u8 *out = dst + Y * dst_stride;
+        for (u32 X = 0; X < whole; X += 32) {
+            const __m256i lit = greater(load32(in + X), thresholds);
+            const u32 bits = reverse_in_bytes(static_cast<u32>(_mm256_movemask_epi8(lit)));
+            for (u32 k = 0; k < 4; k++) out[X / 8 + k] = static_cast<u8>(bits >> (8 * k));
+        }
+    }
+    if (whole < Width) {
+        _mm256_zeroupper();
+        sse2_dither(gray + whole, gray_stride, dst + whole / 8, dst_stride, Width - whole,
+                    Height);
+    }
+}
+
+[[gnu::target("avx2")]] auto avx2_diff(const u8 *prev, const u8 *next) -> Rect {
+    // Two rows per vector, the low half is the even row
+    __m256i columns = _mm256_setzero_si256();
+    i32 first_row = k_height;
+    i32 last_row = -1;
+    for (i32 Y = 0; Y < k_height; Y += 2) {
+        const u32 offset = static_cast<u32>(Y) * k_row_bytes;
+        const __m256i bits = _mm256_xor_si256(load32(prev + offset), load32(next + offset));
+        columns = _mm256_or_si256(columns, bits);
+        const auto same = static_cast<u32>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(bits, _mm256_setzero_si256())));
+        if ((same & 0xFFFFu) != 0xFFFFu) {
+            first_row = first_row < Y ? first_row : Y;
+            last_row = Y;
+        }
+        if ((same >> 16) != 0xFFFFu) {
+            first_row = first_row < Y + 1 ? first_row : Y + 1;
+            last_row = Y + 1;
+        }
+    }
+
+    std::array<u8, k_row_bytes> column_bytes = {};
+    store(column_bytes.data(),
+          _mm_or_si128(_mm256_castsi256_si128(columns), _mm256_extracti128_si256(columns, 1)));
+    return diff_bounds(column_bytes.data(), first_row, last_row);
+}
+
+}  // namespace
+
+constexpr Kernels pico_oled::buffer::k_sse2_kernels = {
+    .fill = sse2_fill,
+    .invert = sse2_invert,
+    .copy = sse2_combine<Copy>,
+    .and_with = sse2_combine<And>,
+    .or_with = sse2_combine<Or>,
+    .xor_with = sse2_combine<Xor>,
+    .blend = sse2_blend,
+    .transpose = sse2_transpose,
+    .dither = sse2_dither,
+    .diff = sse2_diff,
+};
+
+constexpr Kernels pico_oled::buffer::k_avx2_kernels = {
+    .fill = avx2_fill,
+    .invert = avx2_invert,
+    .copy = avx2_combine<Copy>,
+    .and_with = avx2_combine<And>,
+    .or_with = avx2_combine<Or>,
+    .xor_with = avx2_combine<Xor>,
+    .blend = avx2_blend,
+    .transpose = avx2_transpose,
+    .dither = avx2_dither,
+    .diff = avx2_diff,
+};
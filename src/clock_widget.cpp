@@ -0,0 +1,101 @@
+#include "clock_widget.hpp"
+
+#include "dirty_rects.hpp"
+#include "paint.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+using namespace pico_oled::paint;
+using pico_oled::DirtyRects;
+using pico_oled::Rect;
+
+ClockWidget::ClockWidget(i32 Xstart,
+                         i32 Ystart,
+                         const font::Font &Font,
+                         eImageColors Color_Foreground,
+                         eImageColors Color_Background)
+    : m_x(Xstart),
+      m_y(Ystart),
+      m_font(&Font),
+      m_foreground(Color_Foreground),
+      m_background(Color_Background),
+      m_shown(),
+      m_valid(false) {}
+
+auto ClockWidget::cell_x(u8 Index) const -> i32 {
+    // Same offsets as `Paint::draw_time`, the colons sit closer to the digits
+    const i32 Dx = this->m_font->Width;
+    const std::array<i32, k_cells> offsets = {0,
+                                              Dx,
+                                              Dx + Dx / 4 + Dx / 2,
+                                              Dx * 2 + Dx / 2,
+                                              Dx * 3 + Dx / 2,
+                                              Dx * 4 + Dx / 2 - Dx / 4,
+                                              Dx * 5,
+                                              Dx * 6};
+    return this->m_x + offsets[Index];
+}
+
+auto ClockWidget::cell(u8 Index) const -> Rect {
+    const i32 X = this->cell_x(Index);
+    return {static_cast<i16>(X),
+            static_cast<i16>(this->m_y),
+            static_cast<i16>(X + this->m_font->Width - 1),
+            static_cast<i16>(this->m_y + this->m_font->Height - 1)};
+}
+
+auto ClockWidget::draw(Paint &paint, const PaintTime &Time, DirtyRects &Dirty) -> bool {
+    const auto digit = [](u32 value) { return static_cast<char>('0' + value % 10); };
+    const std::array<char, k_cells> text = {digit(Time.Hour / 10u),
+                                            digit(Time.Hour),
+                                            ':',
+                                            digit(Time.Min / 10u),
+                                            digit(Time.Min),
+                                            ':',
+                                            digit(Time.Sec / 10u),
+                                            digit(Time.Sec)};
+
+    if (!this->m_valid) {
+        for (u8 i = 0; i < k_cells; i++) {
+            paint.draw_char(this->cell_x(i),
+                            this->m_y,
+                            text[i],
+                            *this->m_font,
+                            this->m_foreground,
+                            this->m_background);
+        }
+        Dirty.add(this->bounds());
+        this->m_shown = text;
+        this->m_valid = true;
+        return true;
+    }
+
+    bool drawn = false;
+    for (u8 i = 0; i < k_cells; i++) {
+        if (text[i] == this->m_shown[i]) continue;
+
+        // Neighbouring cells overlap, everything reaching into the changed cell is redrawn in
+        // the original order, clipped to it
+        const Rect area = this->cell(i);
+        if (!paint.push_clip(area)) return drawn;
+        for (u8 j = 0; j < k_cells; j++) {
+            if (this->cell(j).intersect(area).empty()) continue;
+            paint.draw_char(this->cell_x(j),
+                            this->m_y,
+                            text[j],
+                            *this->m_font,
+                            this->m_foreground,
+                            this->m_background);
+        }
+        paint.pop_clip();
+
+        Dirty.add(area);
+        this->m_shown[i] = text[i];
+        drawn = true;
+    }
+    return drawn;
+}
+
+auto ClockWidget::invalidate() -> void { this->m_valid = false; }
+
+auto ClockWidget::bounds() const -> Rect { return this->cell(0).unite(this->cell(k_cells - 1)); }
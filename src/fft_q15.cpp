@@ -0,0 +1,84 @@
+#include "fft_q15.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+
+#include "types.hpp"
+
+using namespace pico_oled;
+
+auto dsp::apply_hann(std::span<i16> Samples) -> void {
+    const std::size_t count = Samples.size();
+    if (count == 0 || count > k_fft_max_points) return;
+
+    // Table positions advance in 16.16 fixed point, so any count spreads over the whole table
+    const u32 step = (static_cast<u32>(k_fft_max_points) << 16) / static_cast<u32>(count);
+    u32 position = 0;
+    for (i16 &sample : Samples) {
+        const i32 weight = k_hann_window[position >> 16];
+        sample = static_cast<i16>((sample * weight) >> 15);
+        position += step;
+    }
+}
+
+auto dsp::fft(std::span<i16> Real, std::span<i16> Imag) -> bool {
+    const std::size_t count = Real.size();
+    if (count < 2 || count > k_fft_max_points || !std::has_single_bit(count) ||
+        Imag.size() != count) {
+        return false;
+    }
+    const auto points = static_cast<u32>(count);
+    const auto bits = static_cast<u32>(std::countr_zero(points));
+
+    // Reorders into bit reversed indices, so the butterflies can work in place
+    for (u32 i = 1; i < points; i++) {
+        u32 reversed = 0;
+        for (u32 b = 0; b < bits; b++) reversed |= (i >> b & 1u) << (bits - 1 - b);
+        if (i < reversed) {
+            std::swap(Real[i], Real[reversed]);
+            std::swap(Imag[i], Imag[reversed]);
+        }
+    }
+
+    // cos(x) is sin(x + pi/2), a quarter of the table further
+    constexpr u32 quarter = k_fft_max_points / 4;
+    for (u32 length = 2; length <= points; length <<= 1) {
+        const u32 half = length / 2;
+        const u32 step = k_fft_max_points / length;
+        for (u32 j = 0; j < half; j++) {
+            // W = cos - i sin of the angle 2 pi j / length
+            const u32 k = j * step;
+            const i32 s = k_twiddles[k];
+            const i32 c = k < quarter ? k_twiddles[k + quarter] : -k_twiddles[k - quarter];
+            for (u32 a = j; a < points; a += length) {
+                const u32 b = a + half;
+                const i32 br = Real[b];
+                const i32 bi = Imag[b];
+                const i32 tr = (br * c + bi * s) >> 15;
+                const i32 ti = (bi * c - br * s) >> 15;
+                const i32 ar = Real[a];
+                const i32 ai = Imag[a];
+                Real[a] = static_cast<i16>((ar + tr) >> 1);
+                Imag[a] = static_cast<i16>((ai + ti) >> 1);
+                Real[b] = static_cast<i16>((ar - tr) >> 1);
+                Imag[b] = static_cast<i16>((ai - ti) >> 1);
+            }
+        }
+    }
+    return true;
+}
+
+auto dsp::magnitudes(std::span<const i16> Real,
+                     std::span<const i16> Imag,
+                     std::span<u16> Magnitudes) -> void {
+    const std::size_t count = std::min({Real.size(), Imag.size(), Magnitudes.size()});
+    for (std::size_t i = 0; i < count; i++) {
+        const u32 re = static_cast<u32>(Real[i] < 0 ? -Real[i] : Real[i]);
+        const u32 im = static_cast<u32>(Imag[i] < 0 ? -Imag[i] : Imag[i]);
+        const u32 large = re > im ? re : im;
+        const u32 small = re > im ? im : re;
+        const u32 estimate = large + (3 * small >> 3);
+        Magnitudes[i] = static_cast<u16>(estimate > 0xFFFF ? 0xFFFF : estimate);
+    }
+}
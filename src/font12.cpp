@@ -1373,10 +1373,24 @@ static constexpr uint8_t Font12_Table[] = {
 };
 
 namespace pico_oled::font {
-Font Font12 = {
-    Font12_Table,
-    7,
-    12,
+static constexpr auto Font12_Boxes = make_glyph_boxes(Font12_Table, 7, 12);
+static constexpr auto Font12_Offsets = make_glyph_offsets(7, 12);
+#ifdef PICO_OLED_ROTATED_FONTS
+static constexpr auto Font12_Columns = make_glyph_columns<7, 12>(Font12_Table);
+#endif
+
+constexpr Font Font12 = {
+    .table = Font12_Table,
+    .Width = 7,
+    .Height = 12,
+    .Stride = (7 + 7) / 8,
+    .Count = GLYPH_COUNT,
+    .offsets = Font12_Offsets.data(),
+    .boxes = Font12_Boxes.data(),
+    .Fallback = FALLBACK_CHAR - FIRST_CHAR,
+#ifdef PICO_OLED_ROTATED_FONTS
+    .columns = Font12_Columns.data(),
+#endif
 };
 }
 
@@ -0,0 +1,408 @@
+// Generated by tools/pack_font.py from src/font12.cpp, do not edit.
+
+#include "packed_font.hpp"
+
+namespace pico_oled::font {
+
+static constexpr u8 Font12Packed_Data[] = {
+    // @0 '!'
+    0xF9,
+    // @1 '"'
+    0xDC, 0xA4,
+    // @3 '#'
+    0x29, 0x55, 0xF5, 0x7D, 0x54, 0xA0,
+    // @9 '$'
+    0x27, 0x88, 0x79, 0xE2, 0x20,
+    // @14 '%'
+    0x45, 0x10, 0x3E, 0x08, 0xA2,
+    // @19 '&'
+    0x32, 0x11, 0x59, 0x34,
+    // @23 "'"
+    0xF0,
+    // @24 '('
+    0x5A, 0xAA, 0x50,
+    // @27 ')'
+    0xA5, 0x55, 0xA0,
+    // @30 '*'
+    0x27, 0xC8, 0xA5, 0x00,
+    // @34 '+'
+    0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,
+    // @41 ','
+    0x6B, 0x40,
+    // @43 '-'
+    0xF8,
+    // @44 '.'
+    0xF0,
+    // @45 '/'
+    0x08, 0x44, 0x22, 0x11, 0x08, 0x80,
+    // @51 '0'
+    0x74, 0x63, 0x18, 0xC6, 0x2E,
+    // @56 '1'
+    0x61, 0x08, 0x42, 0x10, 0x9F,
+    // @61 '2'
+    0x74, 0x42, 0x22, 0x22, 0x3F,
+    // @66 '3'
+    0x74, 0x42, 0x60, 0x86, 0x2E,
+    // @71 '4'
+    0x18, 0xA2, 0x92, 0x8B, 0xF0, 0x87,
+    // @77 '5'
+    0x7A, 0x10, 0xE0, 0x86, 0x2E,
+    // @82 '6'
+    0x3A, 0x21, 0xE8, 0xC6, 0x2E,
+    // @87 '7'
+    0xFC, 0x42, 0x21, 0x08, 0x84,
+    // @92 '8'
+    0x74, 0x62, 0xE8, 0xC6, 0x2E,
+    // @97 '9'
+    0x74, 0x63, 0x17, 0x84, 0x5C,
+    // @102 ':'
+    0xF0, 0xF0,
+    // @104 ';'
+    0x6C, 0x07, 0xA0,
+    // @107 '<'
+    0x0C, 0x46, 0x20, 0x60, 0x40, 0xC0,
+    // @113 '='
+    0xF8, 0x3E,
+    // @115 '>'
+    0xC0, 0x81, 0x81, 0x18, 0x8C, 0x00,
+    // @121 '?'
+    0x69, 0x12, 0x40, 0xC0,
+    // @125 '@'
+    0x74, 0x63, 0x3A, 0xD6, 0x70, 0x8B, 0x80,
+    // @132 'A'
+    0x30, 0x20, 0xA1, 0x42, 0x8F, 0x91, 0x77,
+    // @139 'B'
+    0xF9, 0x14, 0x5E, 0x45, 0x14, 0x7E,
+    // @145 'C'
+    0x7C, 0x61, 0x08, 0x42, 0x2E,
+    // @150 'D'
+    0xF1, 0x24, 0x51, 0x45, 0x14, 0xBC,
+    // @156 'E'
+    0xFD, 0x15, 0x1C, 0x51, 0x04, 0x7F,
+    // @162 'F'
+    0xFD, 0x15, 0x1C, 0x51, 0x04, 0x38,
+    // @168 'G'
+    0x7A, 0x28, 0x20, 0x9E, 0x28, 0x9C,
+    // @174 'H'
+    0xEE, 0x89, 0x13, 0xE4, 0x48, 0x91, 0x77,
+    // @181 'I'
+    0xF9, 0x08, 0x42, 0x10, 0x9F,
+    // @186 'J'
+    0x78, 0x84, 0x29, 0x4A, 0x4C,
+    // @191 'K'
+    0xEE, 0x89, 0x22, 0x87, 0x09, 0x11, 0x73,
+    // @198 'L'
+    0xE2, 0x10, 0x84, 0x25, 0x3F,
+    // @203 'M'
+    0xEE, 0xD9, 0xB2, 0xA5, 0x48, 0x91, 0x77,
+    // @210 'N'
+    0xEE, 0xC9, 0x92, 0xA5, 0x4A, 0x93, 0x76,
+    // @217 'O'
+    0x74, 0x63, 0x18, 0xC6, 0x2E,
+    // @222 'P'
+    0xF2, 0x52, 0x97, 0x21, 0x1C,
+    // @227 'Q'
+    0x74, 0x63, 0x18, 0xC6, 0x2E, 0x38,
+    // @233 'R'
+    0xF8, 0x89, 0x12, 0x27, 0x89, 0x11, 0x71,
+    // @240 'S'
+    0x6C, 0xE0, 0xE0, 0x87, 0x36,
+    // @245 'T'
+    0xFF, 0x24, 0x40, 0x81, 0x02, 0x04, 0x1C,
+    // @252 'U'
+    0xEE, 0x89, 0x12, 0x24, 0x48, 0x91, 0x1C,
+    // @259 'V'
+    0xEE, 0x89, 0x11, 0x42, 0x85, 0x04, 0x08,
+    // @266 'W'
+    0xEE, 0x89, 0x12, 0xA5, 0x4A, 0x95, 0x14,
+    // @273 'X'
+    0xC6, 0x88, 0xA0, 0x81, 0x05, 0x11, 0x63,
+    // @280 'Y'
+    0xEE, 0x88, 0xA1, 0x41, 0x02, 0x04, 0x1C,
+    // @287 'Z'
+    0xFC, 0x44, 0x42, 0x22, 0x3F,
+    // @292 '['
+    0xF2, 0x49, 0x24, 0x9C,
+    // @296 '\\'
+    0x84, 0x44, 0x22, 0x11, 0x10,
+    // @301 ']'
+    0xE4, 0x92, 0x49, 0x3C,
+    // @305 '^'
+    0x21, 0x15, 0x10,
+    // @308 '_'
+    0xFE,
+    // @309 '`'
+    0x90,
+    // @310 'a'
+    0x72, 0x27, 0xA2, 0x89, 0xF0,
+    // @315 'b'
+    0xC1, 0x05, 0x99, 0x45, 0x14, 0x7E,
+    // @321 'c'
+    0x7C, 0x61, 0x08, 0xB8,
+    // @325 'd'
+    0x18, 0x26, 0xA6, 0x8A, 0x28, 0x9F,
+    // @331 'e'
+    0x74, 0x7F, 0x08, 0x3C,
+    // @335 'f'
+    0x3A, 0x3E, 0x84, 0x21, 0x1F,
+    // @340 'g'
+    0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x9C,
+    // @346 'h'
+    0xC0, 0x81, 0x63, 0x24, 0x48, 0x91, 0x77,
+    // @353 'i'
+    0x20, 0x38, 0x42, 0x10, 0x9F,
+    // @358 'j'
+    0x20, 0xF1, 0x11, 0x11, 0x1E,
+    // @363 'k'
+    0xC1, 0x05, 0xD2, 0x71, 0x44, 0xB7,
+    // @369 'l'
+    0x61, 0x08, 0x42, 0x10, 0x9F,
+    // @374 'm'
+    0xE8, 0xA9, 0x52, 0xA5, 0x5F, 0xC0,
+    // @380 'n'
+    0xD8, 0xC9, 0x12, 0x24, 0x5D, 0xC0,
+    // @386 'o'
+    0x74, 0x63, 0x18, 0xB8,
+    // @390 'p'
+    0xD9, 0x94, 0x51, 0x45, 0xE4, 0x38,
+    // @396 'q'
+    0x6E, 0x68, 0xA2, 0x89, 0xE0, 0x87,
+    // @402 'r'
+    0xDB, 0x10, 0x84, 0x7C,
+    // @406 's'
+    0x7C, 0x5C, 0x18, 0xF8,
+    // @410 't'
+    0x43, 0xE4, 0x10, 0x41, 0x13, 0x80,
+    // @416 'u'
+    0xCC, 0x89, 0x12, 0x24, 0xC6, 0xC0,
+    // @422 'v'
+    0xEE, 0x89, 0x11, 0x42, 0x82, 0x00,
+    // @428 'w'
+    0xEE, 0x89, 0x52, 0xA5, 0x45, 0x00,
+    // @434 'x'
+    0xCD, 0x23, 0x0C, 0x4B, 0x30,
+    // @439 'y'
+    0xEE, 0x88, 0x91, 0x41, 0x82, 0x04, 0x3C,
+    // @446 'z'
+    0xFC, 0x88, 0x88, 0xFC,
+    // @450 '{'
+    0x29, 0x25, 0x12, 0x44,
+    // @454 '|'
+    0xFF, 0x80,
+    // @456 '}'
+    0x89, 0x24, 0x52, 0x50,
+    // @460 '~'
+    0x4D, 0x80,
+};
+
+static constexpr u16 Font12Packed_Offsets[] = {
+    0,
+    0,
+    1,
+    3,
+    9,
+    14,
+    19,
+    23,
+    24,
+    27,
+    30,
+    34,
+    41,
+    43,
+    44,
+    45,
+    51,
+    56,
+    61,
+    66,
+    71,
+    77,
+    82,
+    87,
+    92,
+    97,
+    102,
+    104,
+    107,
+    113,
+    115,
+    121,
+    125,
+    132,
+    139,
+    145,
+    150,
+    156,
+    162,
+    168,
+    174,
+    181,
+    186,
+    191,
+    198,
+    203,
+    210,
+    217,
+    222,
+    227,
+    233,
+    240,
+    245,
+    252,
+    259,
+    266,
+    273,
+    280,
+    287,
+    292,
+    296,
+    301,
+    305,
+    308,
+    309,
+    310,
+    315,
+    321,
+    325,
+    331,
+    335,
+    340,
+    346,
+    353,
+    358,
+    363,
+    369,
+    374,
+    380,
+    386,
+    390,
+    396,
+    402,
+    406,
+    410,
+    416,
+    422,
+    428,
+    434,
+    439,
+    446,
+    450,
+    454,
+    456,
+    460,
+};
+
+static constexpr GlyphBox Font12Packed_Boxes[] = {
+    {12, 0, 7, 0},  // ' '
+    {1, 8, 3, 3},  // '!'
+    {1, 3, 1, 5},  // '"'
+    {1, 9, 1, 5},  // '#'
+    {1, 9, 1, 4},  // '$'
+    {1, 8, 1, 5},  // '%'
+    {3, 8, 1, 5},  // '&'
+    {1, 4, 3, 3},  // "'"
+    {1, 10, 3, 4},  // '('
+    {1, 10, 2, 3},  // ')'
+    {1, 5, 1, 5},  // '*'
+    {2, 8, 0, 6},  // '+'
+    {7, 10, 2, 4},  // ','
+    {5, 5, 1, 5},  // '-'
+    {7, 8, 2, 3},  // '.'
+    {1, 9, 1, 5},  // '/'
+    {1, 8, 1, 5},  // '0'
+    {1, 8, 1, 5},  // '1'
+    {1, 8, 1, 5},  // '2'
+    {1, 8, 1, 5},  // '3'
+    {1, 8, 1, 6},  // '4'
+    {1, 8, 1, 5},  // '5'
+    {1, 8, 1, 5},  // '6'
+    {1, 8, 1, 5},  // '7'
+    {1, 8, 1, 5},  // '8'
+    {1, 8, 1, 5},  // '9'
+    {3, 8, 2, 3},  // ':'
+    {3, 9, 2, 4},  // ';'
+    {2, 8, 0, 5},  // '<'
+    {4, 6, 1, 5},  // '='
+    {2, 8, 0, 5},  // '>'
+    {2, 8, 2, 5},  // '?'
+    {0, 9, 1, 5},  // '@'
+    {1, 8, 0, 6},  // 'A'
+    {1, 8, 0, 5},  // 'B'
+    {1, 8, 1, 5},  // 'C'
+    {1, 8, 0, 5},  // 'D'
+    {1, 8, 0, 5},  // 'E'
+    {1, 8, 1, 6},  // 'F'
+    {1, 8, 1, 6},  // 'G'
+    {1, 8, 0, 6},  // 'H'
+    {1, 8, 1, 5},  // 'I'
+    {1, 8, 1, 5},  // 'J'
+    {1, 8, 0, 6},  // 'K'
+    {1, 8, 1, 5},  // 'L'
+    {1, 8, 0, 6},  // 'M'
+    {1, 8, 0, 6},  // 'N'
+    {1, 8, 1, 5},  // 'O'
+    {1, 8, 1, 5},  // 'P'
+    {1, 9, 1, 5},  // 'Q'
+    {1, 8, 0, 6},  // 'R'
+    {1, 8, 1, 5},  // 'S'
+    {1, 8, 0, 6},  // 'T'
+    {1, 8, 0, 6},  // 'U'
+    {1, 8, 0, 6},  // 'V'
+    {1, 8, 0, 6},  // 'W'
+    {1, 8, 0, 6},  // 'X'
+    {1, 8, 0, 6},  // 'Y'
+    {1, 8, 1, 5},  // 'Z'
+    {1, 10, 2, 4},  // '['
+    {1, 9, 1, 4},  // '\\'
+    {1, 10, 2, 4},  // ']'
+    {1, 4, 1, 5},  // '^'
+    {11, 11, 0, 6},  // '_'
+    {1, 2, 3, 4},  // '`'
+    {3, 8, 1, 6},  // 'a'
+    {1, 8, 0, 5},  // 'b'
+    {3, 8, 1, 5},  // 'c'
+    {1, 8, 1, 6},  // 'd'
+    {3, 8, 1, 5},  // 'e'
+    {1, 8, 1, 5},  // 'f'
+    {3, 10, 1, 6},  // 'g'
+    {1, 8, 0, 6},  // 'h'
+    {1, 8, 1, 5},  // 'i'
+    {1, 10, 1, 4},  // 'j'
+    {1, 8, 0, 5},  // 'k'
+    {1, 8, 1, 5},  // 'l'
+    {3, 8, 0, 6},  // 'm'
+    {3, 8, 0, 6},  // 'n'
+    {3, 8, 1, 5},  // 'o'
+    {3, 10, 0, 5},  // 'p'
+    {3, 10, 1, 6},  // 'q'
+    {3, 8, 1, 5},  // 'r'
+    {3, 8, 1, 5},  // 's'
+    {2, 8, 1, 6},  // 't'
+    {3, 8, 0, 6},  // 'u'
+    {3, 8, 0, 6},  // 'v'
+    {3, 8, 0, 6},  // 'w'
+    {3, 8, 0, 5},  // 'x'
+    {3, 10, 0, 6},  // 'y'
+    {3, 8, 1, 5},  // 'z'
+    {1, 10, 2, 4},  // '{'
+    {1, 9, 3, 3},  // '|'
+    {1, 10, 2, 4},  // '}'
+    {5, 6, 1, 5},  // '~'
+};
+
+// Declared extern first, a constexpr variable alone has internal linkage
+extern const PackedFont Font12Packed;
+constexpr PackedFont Font12Packed = {
+    .data = Font12Packed_Data,
+    .Width = 7,
+    .Height = 12,
+    .Stride = (7 + 7) / 8,
+    .Count = 95,
+    .codes = nullptr,
+    .offsets = Font12Packed_Offsets,
+    .boxes = Font12Packed_Boxes,
+    .Fallback = 31,
+};
+
+}  // namespace pico_oled::font
@@ -1753,10 +1753,24 @@ static constexpr uint8_t Font16_Table[] = {
 };
 
 namespace pico_oled::font {
-Font Font16 = {
-    Font16_Table,
-    11,
-    16,
+static constexpr auto Font16_Boxes = make_glyph_boxes(Font16_Table, 11, 16);
+static constexpr auto Font16_Offsets = make_glyph_offsets(11, 16);
+#ifdef PICO_OLED_ROTATED_FONTS
+static constexpr auto Font16_Columns = make_glyph_columns<11, 16>(Font16_Table);
+#endif
+
+constexpr Font Font16 = {
+    .table = Font16_Table,
+    .Width = 11,
+    .Height = 16,
+    .Stride = (11 + 7) / 8,
+    .Count = GLYPH_COUNT,
+    .offsets = Font16_Offsets.data(),
+    .boxes = Font16_Boxes.data(),
+    .Fallback = FALLBACK_CHAR - FIRST_CHAR,
+#ifdef PICO_OLED_ROTATED_FONTS
+    .columns = Font16_Columns.data(),
+#endif
 };
 }
 
@@ -0,0 +1,414 @@
+// Generated by tools/pack_font.py from src/font16.cpp, do not edit.
+
+#include "packed_font.hpp"
+
+namespace pico_oled::font {
+
+static constexpr u8 Font16Packed_Data[] = {
+    // @0 '!'
+    0xFF, 0xFF, 0x30,
+    // @3 '"'
+    0xEF, 0xDD, 0x12, 0x24, 0x40,
+    // @8 '#'
+    0x36, 0x36, 0x36, 0x36, 0xFF, 0x6C, 0xFF, 0x6C, 0x6C, 0x6C, 0x6C,
+    // @19 '$'
+    0x10, 0xFF, 0x1E, 0x3E, 0x0F, 0x0F, 0x07, 0xC7, 0x8F, 0xF0, 0x81, 0x00,
+    // @31 '%'
+    0x60, 0x90, 0x90, 0x63, 0x1E, 0x78, 0xC6, 0x09, 0x09, 0x06,
+    // @41 '&'
+    0x3C, 0xC1, 0x83, 0x03, 0x0E, 0xF7, 0x66, 0x76,
+    // @49 "'"
+    0xFD, 0x24,
+    // @51 '('
+    0x33, 0x6E, 0xCC, 0xCC, 0xE6, 0x33,
+    // @57 ')'
+    0xCC, 0x63, 0x33, 0x33, 0x36, 0xEC,
+    // @63 '*'
+    0x18, 0x18, 0xFF, 0xFF, 0x3C, 0x7E, 0x66,
+    // @70 '+'
+    0x10, 0x20, 0x47, 0xF1, 0x02, 0x04, 0x00,
+    // @77 ','
+    0x6B, 0x48,
+    // @79 '-'
+    0xFE,
+    // @80 '.'
+    0xF0,
+    // @81 '/'
+    0x03, 0x03, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x30, 0x30, 0x60, 0x60, 0xC0,
+    0xC0,
+    // @94 '0'
+    0x38, 0xDB, 0x1E, 0x3C, 0x78, 0xF1, 0xE3, 0x6C, 0x70,
+    // @103 '1'
+    0x18, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+    // @113 '2'
+    0x3C, 0xCF, 0x1E, 0x30, 0xC3, 0x0C, 0x30, 0xC1, 0xFC,
+    // @122 '3'
+    0x7E, 0xC3, 0x03, 0x06, 0x3E, 0x07, 0x03, 0x03, 0xC3, 0x7E,
+    // @132 '4'
+    0x1C, 0x38, 0xF1, 0x66, 0xC9, 0xB3, 0x7F, 0x0C, 0x7C,
+    // @141 '5'
+    0x7E, 0xC1, 0x83, 0x07, 0xC8, 0xC1, 0x83, 0x86, 0xF8,
+    // @150 '6'
+    0x1E, 0xE1, 0x86, 0x0D, 0xDC, 0xF1, 0xE3, 0x66, 0x78,
+    // @159 '7'
+    0xFF, 0x0C, 0x18, 0x60, 0xC1, 0x83, 0x0C, 0x18, 0x30,
+    // @168 '8'
+    0x7D, 0x8F, 0x1E, 0x37, 0xD8, 0xF1, 0xE3, 0xC6, 0xF8,
+    // @177 '9'
+    0x79, 0x9B, 0x1E, 0x3C, 0xEE, 0xC1, 0x86, 0x1D, 0xE0,
+    // @186 ':'
+    0xF0, 0x3C,
+    // @188 ';'
+    0x33, 0x00, 0x06, 0x48, 0x80,
+    // @193 '<'
+    0x01, 0x83, 0x02, 0x06, 0x0C, 0x01, 0x80, 0x20, 0x0C, 0x01, 0x80,
+    // @204 '='
+    0xFF, 0x80, 0x3F, 0xE0,
+    // @208 '>'
+    0xC0, 0x18, 0x02, 0x00, 0xC0, 0x18, 0x30, 0x20, 0x60, 0xC0, 0x00,
+    // @219 '?'
+    0x7D, 0x8F, 0x18, 0x31, 0xC6, 0x0C, 0x00, 0x30,
+    // @227 '@'
+    0x39, 0x18, 0x61, 0x9E, 0x9A, 0x67, 0x81, 0x13, 0x80,
+    // @236 'A'
+    0x7E, 0x07, 0x81, 0x20, 0xCC, 0x33, 0x0F, 0xC6, 0x19, 0x86, 0xF3, 0xC0,
+    // @248 'B'
+    0xFE, 0x63, 0x63, 0x63, 0x7E, 0x63, 0x63, 0x63, 0xFE,
+    // @257 'C'
+    0x3E, 0xB0, 0xF0, 0x38, 0x0C, 0x06, 0x03, 0x02, 0xC2, 0x3E, 0x00,
+    // @268 'D'
+    0xFE, 0x31, 0x98, 0x6C, 0x36, 0x1B, 0x0D, 0x86, 0xC6, 0xFE, 0x00,
+    // @279 'E'
+    0xFF, 0x61, 0x61, 0x64, 0x7C, 0x64, 0x61, 0x61, 0xFF,
+    // @288 'F'
+    0xFF, 0xB0, 0x58, 0x2C, 0x87, 0xC3, 0x21, 0x80, 0xC0, 0xF8, 0x00,
+    // @299 'G'
+    0x3D, 0x31, 0xB0, 0x58, 0x0C, 0x06, 0x7F, 0x0C, 0xC6, 0x3E, 0x00,
+    // @310 'H'
+    0xF7, 0xB1, 0x98, 0xCC, 0x67, 0xF3, 0x19, 0x8C, 0xC6, 0xF7, 0x80,
+    // @321 'I'
+    0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+    // @330 'J'
+    0x3F, 0x83, 0x01, 0x80, 0xC0, 0x66, 0x33, 0x19, 0x8C, 0x7C, 0x00,
+    // @341 'K'
+    0xF7, 0xB1, 0x99, 0x8D, 0x87, 0x83, 0xE1, 0x98, 0xC6, 0xF3, 0x80,
+    // @352 'L'
+    0xFC, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x84, 0xC2, 0x61, 0xFF, 0x80,
+    // @363 'M'
+    0xE0, 0xEC, 0x19, 0xC7, 0x3D, 0xE6, 0xAC, 0xDD, 0x99, 0x33, 0x06, 0xFB,
+    0xE0,
+    // @376 'N'
+    0xE7, 0xB1, 0x9C, 0xCF, 0x66, 0xB3, 0x79, 0x9C, 0xC6, 0xF3, 0x00,
+    // @387 'O'
+    0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x00,
+    // @398 'P'
+    0xFE, 0x63, 0x63, 0x63, 0x63, 0x7E, 0x60, 0x60, 0xFC,
+    // @407 'Q'
+    0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1E, 0x0F, 0x06, 0xC6, 0x3E, 0x0C, 0xCF,
+    0xC0,
+    // @420 'R'
+    0xFE, 0x18, 0xC6, 0x31, 0x8C, 0x7C, 0x19, 0x86, 0x31, 0x8C, 0xF9, 0xC0,
+    // @432 'S'
+    0x7F, 0x8F, 0x1F, 0x07, 0xC1, 0xF1, 0xE3, 0xFC,
+    // @440 'T'
+    0xFF, 0x99, 0x99, 0x99, 0x18, 0x18, 0x18, 0x18, 0x7E,
+    // @449 'U'
+    0xF7, 0xB1, 0x98, 0xCC, 0x66, 0x33, 0x19, 0x8C, 0xC6, 0x3E, 0x00,
+    // @460 'V'
+    0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x61, 0xB0, 0x50, 0x38, 0x1C, 0x00,
+    // @471 'W'
+    0xFB, 0xEC, 0x19, 0x93, 0x37, 0x66, 0xEC, 0x55, 0x0E, 0xE1, 0xDC, 0x31,
+    0x80,
+    // @484 'X'
+    0xF7, 0xB1, 0x8D, 0x83, 0x81, 0xC0, 0xE0, 0xD8, 0xC6, 0xF7, 0x80,
+    // @495 'Y'
+    0xF3, 0xD8, 0x63, 0x30, 0x78, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x3F, 0x00,
+    // @507 'Z'
+    0xFF, 0x0E, 0x30, 0xC1, 0x06, 0x18, 0xE1, 0xFE,
+    // @515 '['
+    0xFC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCF,
+    // @521 '\\'
+    0xC0, 0xC0, 0x60, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x06, 0x03,
+    0x03,
+    // @534 ']'
+    0xF3, 0x33, 0x33, 0x33, 0x33, 0x3F,
+    // @540 '^'
+    0x10, 0x50, 0xA2, 0x28, 0x30, 0x40,
+    // @546 '_'
+    0xFF, 0xE0,
+    // @548 '`'
+    0x88, 0x80,
+    // @550 'a'
+    0x7C, 0x06, 0x06, 0x7E, 0xC6, 0xCE, 0x77,
+    // @557 'b'
+    0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x0D, 0x86, 0xC3, 0x73, 0x77, 0x00,
+    // @569 'c'
+    0x3D, 0x63, 0xC1, 0xC0, 0xC1, 0x63, 0x3E,
+    // @576 'd'
+    0x07, 0x01, 0x80, 0xC7, 0x66, 0x76, 0x1B, 0x0D, 0x86, 0x67, 0x1D, 0xC0,
+    // @588 'e'
+    0x3E, 0x31, 0xB0, 0x7F, 0xFC, 0x03, 0x0C, 0xFC,
+    // @596 'f'
+    0x1F, 0x98, 0x0C, 0x1F, 0xC3, 0x01, 0x80, 0xC0, 0x60, 0x30, 0x7F, 0x00,
+    // @608 'g'
+    0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x1F, 0x00,
+    // @620 'h'
+    0xE0, 0x30, 0x18, 0x0D, 0xC7, 0x33, 0x19, 0x8C, 0xC6, 0x63, 0x7B, 0xC0,
+    // @632 'i'
+    0x18, 0x18, 0x00, 0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+    // @642 'j'
+    0x18, 0x60, 0x3F, 0x0C, 0x30, 0xC3, 0x0C, 0x30, 0xC3, 0xF8,
+    // @652 'k'
+    0xE0, 0x30, 0x18, 0x0D, 0xE6, 0xC3, 0xC1, 0xE0, 0xD8, 0x66, 0x77, 0xC0,
+    // @664 'l'
+    0x78, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+    // @674 'm'
+    0xFF, 0x1B, 0x66, 0xD9, 0xB6, 0x6D, 0x9B, 0x6E, 0xDC,
+    // @683 'n'
+    0xEE, 0x39, 0x98, 0xCC, 0x66, 0x33, 0x1B, 0xDE,
+    // @691 'o'
+    0x3E, 0x31, 0xB0, 0x78, 0x3C, 0x1B, 0x18, 0xF8,
+    // @699 'p'
+    0xEE, 0x39, 0x98, 0x6C, 0x36, 0x1B, 0x99, 0xB8, 0xC0, 0x60, 0x7C, 0x00,
+    // @711 'q'
+    0x3B, 0xB3, 0xB0, 0xD8, 0x6C, 0x33, 0x38, 0xEC, 0x06, 0x03, 0x07, 0xC0,
+    // @723 'r'
+    0xF7, 0x1C, 0xCC, 0x06, 0x03, 0x01, 0x83, 0xF8,
+    // @731 's'
+    0x7F, 0x8F, 0xC3, 0xE0, 0xF8, 0xFF, 0x00,
+    // @738 't'
+    0x30, 0x30, 0x30, 0xFE, 0x30, 0x30, 0x30, 0x30, 0x31, 0x1E,
+    // @748 'u'
+    0xE7, 0x31, 0x98, 0xCC, 0x66, 0x33, 0x38, 0xEE,
+    // @756 'v'
+    0xF7, 0xB1, 0x98, 0xC6, 0xC3, 0x60, 0xE0, 0x70,
+    // @764 'w'
+    0xF1, 0xEC, 0x19, 0x93, 0x37, 0x63, 0xB8, 0x77, 0x0C, 0x60,
+    // @774 'x'
+    0xF7, 0x9B, 0x07, 0x03, 0x81, 0xC1, 0xB3, 0xDE,
+    // @782 'y'
+    0xF3, 0xD8, 0x63, 0x30, 0xCC, 0x16, 0x07, 0x80, 0xC0, 0x30, 0x18, 0x1F,
+    0x00,
+    // @795 'z'
+    0xFF, 0x0C, 0x31, 0xC6, 0x18, 0x7F, 0x80,
+    // @802 '{'
+    0x36, 0x66, 0x66, 0xC6, 0x66, 0x63,
+    // @808 '|'
+    0xFF, 0xFF, 0xFF,
+    // @811 '}'
+    0xC6, 0x66, 0x66, 0x36, 0x66, 0x6C,
+    // @817 '~'
+    0x61, 0x24, 0x30,
+};
+
+static constexpr u16 Font16Packed_Offsets[] = {
+    0,
+    0,
+    3,
+    8,
+    19,
+    31,
+    41,
+    49,
+    51,
+    57,
+    63,
+    70,
+    77,
+    79,
+    80,
+    81,
+    94,
+    103,
+    113,
+    122,
+    132,
+    141,
+    150,
+    159,
+    168,
+    177,
+    186,
+    188,
+    193,
+    204,
+    208,
+    219,
+    227,
+    236,
+    248,
+    257,
+    268,
+    279,
+    288,
+    299,
+    310,
+    321,
+    330,
+    341,
+    352,
+    363,
+    376,
+    387,
+    398,
+    407,
+    420,
+    432,
+    440,
+    449,
+    460,
+    471,
+    484,
+    495,
+    507,
+    515,
+    521,
+    534,
+    540,
+    546,
+    548,
+    550,
+    557,
+    569,
+    576,
+    588,
+    596,
+    608,
+    620,
+    632,
+    642,
+    652,
+    664,
+    674,
+    683,
+    691,
+    699,
+    711,
+    723,
+    731,
+    738,
+    748,
+    756,
+    764,
+    774,
+    782,
+    795,
+    802,
+    808,
+    811,
+    817,
+};
+
+static constexpr GlyphBox Font16Packed_Boxes[] = {
+    {16, 0, 11, 0},  // ' '
+    {1, 10, 4, 5},  // '!'
+    {2, 6, 3, 9},  // '"'
+    {1, 11, 2, 9},  // '#'
+    {0, 12, 2, 8},  // '$'
+    {1, 10, 2, 9},  // '%'
+    {2, 10, 2, 8},  // '&'
+    {2, 6, 5, 7},  // "'"
+    {1, 12, 4, 7},  // '('
+    {1, 12, 3, 6},  // ')'
+    {1, 7, 2, 9},  // '*'
+    {3, 9, 2, 8},  // '+'
+    {9, 13, 4, 6},  // ','
+    {6, 6, 2, 8},  // '-'
+    {9, 10, 4, 5},  // '.'
+    {0, 12, 2, 9},  // '/'
+    {1, 10, 2, 8},  // '0'
+    {1, 10, 2, 9},  // '1'
+    {1, 10, 2, 8},  // '2'
+    {1, 10, 1, 8},  // '3'
+    {1, 10, 2, 8},  // '4'
+    {1, 10, 2, 8},  // '5'
+    {1, 10, 2, 8},  // '6'
+    {1, 10, 1, 7},  // '7'
+    {1, 10, 2, 8},  // '8'
+    {1, 10, 2, 8},  // '9'
+    {4, 10, 4, 5},  // ':'
+    {4, 12, 4, 7},  // ';'
+    {2, 10, 1, 9},  // '<'
+    {5, 7, 1, 9},  // '='
+    {2, 10, 1, 9},  // '>'
+    {2, 10, 2, 8},  // '?'
+    {1, 11, 2, 7},  // '@'
+    {2, 10, 1, 10},  // 'A'
+    {2, 10, 1, 8},  // 'B'
+    {2, 10, 1, 9},  // 'C'
+    {2, 10, 1, 9},  // 'D'
+    {2, 10, 1, 8},  // 'E'
+    {2, 10, 1, 9},  // 'F'
+    {2, 10, 1, 9},  // 'G'
+    {2, 10, 1, 9},  // 'H'
+    {2, 10, 2, 9},  // 'I'
+    {2, 10, 1, 9},  // 'J'
+    {2, 10, 1, 9},  // 'K'
+    {2, 10, 1, 9},  // 'L'
+    {2, 10, 0, 10},  // 'M'
+    {2, 10, 1, 9},  // 'N'
+    {2, 10, 1, 9},  // 'O'
+    {2, 10, 1, 8},  // 'P'
+    {2, 12, 1, 9},  // 'Q'
+    {2, 10, 1, 10},  // 'R'
+    {2, 10, 2, 8},  // 'S'
+    {2, 10, 1, 8},  // 'T'
+    {2, 10, 1, 9},  // 'U'
+    {2, 10, 1, 9},  // 'V'
+    {2, 10, 0, 10},  // 'W'
+    {2, 10, 1, 9},  // 'X'
+    {2, 10, 1, 10},  // 'Y'
+    {2, 10, 2, 8},  // 'Z'
+    {1, 12, 5, 8},  // '['
+    {0, 12, 2, 9},  // '\\'
+    {1, 12, 3, 6},  // ']'
+    {0, 5, 2, 8},  // '^'
+    {15, 15, 0, 10},  // '_'
+    {0, 2, 4, 6},  // '`'
+    {4, 10, 2, 9},  // 'a'
+    {1, 10, 1, 9},  // 'b'
+    {4, 10, 1, 8},  // 'c'
+    {1, 10, 1, 9},  // 'd'
+    {4, 10, 1, 9},  // 'e'
+    {1, 10, 2, 10},  // 'f'
+    {4, 13, 1, 9},  // 'g'
+    {1, 10, 1, 9},  // 'h'
+    {1, 10, 2, 9},  // 'i'
+    {1, 13, 2, 7},  // 'j'
+    {1, 10, 1, 9},  // 'k'
+    {1, 10, 2, 9},  // 'l'
+    {4, 10, 1, 10},  // 'm'
+    {4, 10, 1, 9},  // 'n'
+    {4, 10, 1, 9},  // 'o'
+    {4, 13, 1, 9},  // 'p'
+    {4, 13, 1, 9},  // 'q'
+    {4, 10, 1, 9},  // 'r'
+    {4, 10, 2, 8},  // 's'
+    {1, 10, 1, 8},  // 't'
+    {4, 10, 1, 9},  // 'u'
+    {4, 10, 1, 9},  // 'v'
+    {4, 10, 0, 10},  // 'w'
+    {4, 10, 1, 9},  // 'x'
+    {4, 13, 1, 10},  // 'y'
+    {4, 10, 2, 8},  // 'z'
+    {1, 12, 3, 6},  // '{'
+    {1, 12, 5, 6},  // '|'
+    {1, 12, 4, 7},  // '}'
+    {5, 7, 2, 8},  // '~'
+};
+
+// Declared extern first, a constexpr variable alone has internal linkage
+extern const PackedFont Font16Packed;
+constexpr PackedFont Font16Packed = {
+    .data = Font16Packed_Data,
+    .Width = 11,
+    .Height = 16,
+    .Stride = (11 + 7) / 8,
+    .Count = 95,
+    .codes = nullptr,
+    .offsets = Font16Packed_Offsets,
+    .boxes = Font16Packed_Boxes,
+    .Fallback = 31,
+};
+
+}  // namespace pico_oled::font
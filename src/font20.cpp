@@ -2135,10 +2135,24 @@ static constexpr uint8_t Font20_Table[] = {
 
 
 namespace pico_oled::font {
-Font Font20 = {
-    Font20_Table,
-    14,
-    20,
+static constexpr auto Font20_Boxes = make_glyph_boxes(Font20_Table, 14, 20);
+static constexpr auto Font20_Offsets = make_glyph_offsets(14, 20);
+#ifdef PICO_OLED_ROTATED_FONTS
+static constexpr auto Font20_Columns = make_glyph_columns<14, 20>(Font20_Table);
+#endif
+
+constexpr Font Font20 = {
+    .table = Font20_Table,
+    .Width = 14,
+    .Height = 20,
+    .Stride = (14 + 7) / 8,
+    .Count = GLYPH_COUNT,
+    .offsets = Font20_Offsets.data(),
+    .boxes = Font20_Boxes.data(),
+    .Fallback = FALLBACK_CHAR - FIRST_CHAR,
+#ifdef PICO_OLED_ROTATED_FONTS
+    .columns = Font20_Columns.data(),
+#endif
 };
 }
 
@@ -0,0 +1,468 @@
+// Generated by tools/pack_font.py from src/font20.cpp, do not edit.
+
+#include "packed_font.hpp"
+
+namespace pico_oled::font {
+
+static constexpr u8 Font20Packed_Data[] = {
+    // @0 '!'
+    0xFF, 0xFF, 0xFA, 0x40, 0x7E,
+    // @5 '"'
+    0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42,
+    // @11 '#'
+    0x33, 0x0C, 0xC3, 0x30, 0xCC, 0x33, 0x3F, 0xFF, 0xFC, 0xCC, 0x33, 0x3F,
+    0xFF, 0xFC, 0xCC, 0x33, 0x0C, 0xC3, 0x30, 0xCC,
+    // @31 '$'
+    0x18, 0x18, 0x3F, 0x7F, 0xC3, 0xC0, 0xF8, 0x7E, 0x07, 0xC3, 0xC3, 0xFE,
+    0xFC, 0x18, 0x18, 0x18,
+    // @47 '%'
+    0x70, 0x44, 0x22, 0x11, 0x07, 0x18, 0x3C, 0xF9, 0xE0, 0xC7, 0x04, 0x42,
+    0x21, 0x10, 0x70,
+    // @62 '&'
+    0x1F, 0x3F, 0x98, 0x0C, 0x03, 0x03, 0xCF, 0xFF, 0x9E, 0xC6, 0x7F, 0xCF,
+    0x60,
+    // @75 "'"
+    0xFF, 0xA4, 0x80,
+    // @78 '('
+    0x33, 0x66, 0x6C, 0xCC, 0xCC, 0xC6, 0x66, 0x33,
+    // @86 ')'
+    0xCC, 0x66, 0x63, 0x33, 0x33, 0x36, 0x66, 0xCC,
+    // @94 '*'
+    0x18, 0x18, 0x18, 0xDB, 0xFF, 0x3C, 0x3C, 0x7E, 0x66,
+    // @103 '+'
+    0x0C, 0x03, 0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03,
+    0x00,
+    // @116 ','
+    0x76, 0x6C, 0xC8,
+    // @119 '-'
+    0xFF, 0xFF, 0xC0,
+    // @122 '.'
+    0xFF, 0x80,
+    // @124 '/'
+    0x03, 0x03, 0x06, 0x06, 0x06, 0x0C, 0x0C, 0x18, 0x18, 0x30, 0x30, 0x60,
+    0x60, 0x60, 0xC0, 0xC0,
+    // @140 '0'
+    0x3E, 0x3F, 0x98, 0xD8, 0x3C, 0x1E, 0x0F, 0x07, 0x83, 0xC1, 0xE0, 0xD8,
+    0xCF, 0xE3, 0xE0,
+    // @155 '1'
+    0x18, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+    0xFF,
+    // @168 '2'
+    0x3E, 0x3F, 0xB8, 0xF8, 0x30, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18,
+    0x1F, 0xFF, 0xF8,
+    // @183 '3'
+    0x1F, 0x1F, 0xE6, 0x1C, 0x03, 0x01, 0xC3, 0xE0, 0xF8, 0x07, 0x00, 0xC0,
+    0x3C, 0x1F, 0xFE, 0x7F, 0x00,
+    // @200 '4'
+    0x07, 0x07, 0x83, 0xC3, 0x63, 0x31, 0x99, 0x8D, 0x86, 0xFF, 0xFF, 0xC0,
+    0xC1, 0xF0, 0xF8,
+    // @215 '5'
+    0x7F, 0x3F, 0x98, 0x0C, 0x07, 0xE3, 0xF9, 0x8E, 0x03, 0x01, 0x80, 0xF0,
+    0xFF, 0xE7, 0xE0,
+    // @230 '6'
+    0x0F, 0x9F, 0xDE, 0x0C, 0x0E, 0x06, 0xF3, 0xFD, 0xC7, 0xC1, 0xE0, 0xD8,
+    0xEF, 0xE1, 0xE0,
+    // @245 '7'
+    0xFF, 0xFF, 0xF0, 0x60, 0x30, 0x30, 0x18, 0x0C, 0x0C, 0x06, 0x03, 0x03,
+    0x01, 0x80, 0xC0,
+    // @260 '8'
+    0x3E, 0x3F, 0xB8, 0xF8, 0x3E, 0x3B, 0xF9, 0xFD, 0xC7, 0xC1, 0xE0, 0xF8,
+    0xEF, 0xE3, 0xE0,
+    // @275 '9'
+    0x3C, 0x3F, 0xB8, 0xD8, 0x3C, 0x1F, 0x1D, 0xFE, 0x7B, 0x03, 0x81, 0x83,
+    0xDF, 0xCF, 0x80,
+    // @290 ':'
+    0xFF, 0x80, 0x3F, 0xE0,
+    // @294 ';'
+    0x39, 0xCE, 0x00, 0x01, 0xCC, 0xC6, 0x20,
+    // @301 '<'
+    0x00, 0x60, 0x3C, 0x1E, 0x07, 0x03, 0x81, 0xE0, 0x0E, 0x00, 0x70, 0x07,
+    0x80, 0x3C, 0x01, 0x80,
+    // @317 '='
+    0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xC0,
+    // @326 '>'
+    0xC0, 0x1E, 0x00, 0xF0, 0x07, 0x00, 0x38, 0x03, 0xC0, 0xE0, 0x70, 0x3C,
+    0x1E, 0x03, 0x00, 0x00,
+    // @342 '?'
+    0x7C, 0xFE, 0xC3, 0xC3, 0x03, 0x0E, 0x1C, 0x18, 0x00, 0x00, 0x38, 0x38,
+    // @354 '@'
+    0x1C, 0xC9, 0x0C, 0x18, 0x31, 0xE4, 0xC9, 0x93, 0x1E, 0x02, 0x04, 0x27,
+    0x80,
+    // @367 'A'
+    0x3F, 0x03, 0xF0, 0x07, 0x00, 0xD8, 0x0D, 0x81, 0x98, 0x18, 0xC3, 0xFC,
+    0x3F, 0xC6, 0x06, 0xF0, 0xFF, 0x0F,
+    // @385 'B'
+    0xFE, 0x3F, 0xC6, 0x19, 0x86, 0x63, 0x9F, 0xC7, 0xF9, 0x87, 0x60, 0xD8,
+    0x3F, 0xFF, 0xFE,
+    // @400 'C'
+    0x1E, 0xCF, 0xF7, 0x1F, 0x83, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xE0, 0xDC,
+    0x73, 0xF8, 0x7C,
+    // @415 'D'
+    0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x76, 0x06, 0xC0, 0xD8, 0x1B, 0x03, 0x60,
+    0xEC, 0x3B, 0xFE, 0x7F, 0x80,
+    // @432 'E'
+    0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0xD8,
+    0x3F, 0xFF, 0xFF,
+    // @447 'F'
+    0xFF, 0xFF, 0xF6, 0x0D, 0x83, 0x66, 0x1F, 0x87, 0xE1, 0x98, 0x60, 0x18,
+    0x0F, 0xC3, 0xF0,
+    // @462 'G'
+    0x1E, 0xCF, 0xF9, 0x87, 0x60, 0x6C, 0x01, 0x80, 0x31, 0xFE, 0x3F, 0xC0,
+    0xCC, 0x19, 0xFF, 0x0F, 0x80,
+    // @479 'H'
+    0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x9F, 0xE7, 0xF9, 0x86, 0x61, 0x98,
+    0x6F, 0x3F, 0xCF,
+    // @494 'I'
+    0xFF, 0xFF, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF, 0xFF,
+    // @506 'J'
+    0x0F, 0xE1, 0xFC, 0x06, 0x00, 0xC0, 0x18, 0x03, 0x30, 0x66, 0x0C, 0xC1,
+    0x98, 0x73, 0xFC, 0x1F, 0x00,
+    // @523 'K'
+    0xFB, 0xFF, 0x7D, 0x8E, 0x33, 0x06, 0xC0, 0xF8, 0x1D, 0x83, 0x18, 0x63,
+    0x0C, 0x33, 0xE7, 0xFC, 0x70,
+    // @540 'L'
+    0xFC, 0x3F, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC3, 0x30, 0xCC,
+    0x3F, 0xFF, 0xFF,
+    // @555 'M'
+    0xF0, 0xFF, 0x0F, 0x70, 0xE7, 0x9E, 0x69, 0x66, 0xF6, 0x6F, 0x66, 0x66,
+    0x66, 0x66, 0x06, 0xF9, 0xFF, 0x9F,
+    // @573 'N'
+    0xE7, 0xFD, 0xF7, 0x19, 0xE6, 0x79, 0x9B, 0x66, 0xD9, 0x9E, 0x67, 0x98,
+    0xEF, 0xBB, 0xE6,
+    // @588 'O'
+    0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC,
+    0xE3, 0xF0, 0x78,
+    // @603 'P'
+    0xFF, 0x3F, 0xE6, 0x1D, 0x83, 0x60, 0xD8, 0x77, 0xF9, 0xFC, 0x60, 0x18,
+    0x0F, 0xC3, 0xF0,
+    // @618 'Q'
+    0x1E, 0x0F, 0xC7, 0x3B, 0x87, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xE1, 0xDC,
+    0xE3, 0xF0, 0x78, 0x1E, 0xCF, 0xF3, 0x38,
+    // @637 'R'
+    0xFF, 0x1F, 0xF1, 0x87, 0x30, 0x66, 0x1C, 0xFF, 0x1F, 0xC3, 0x1C, 0x61,
+    0x8C, 0x3B, 0xE3, 0xFC, 0x30,
+    // @654 'S'
+    0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xE0, 0x1F, 0x81, 0xF8, 0x07, 0xC0, 0xF8,
+    0x7F, 0xFB, 0x7C,
+    // @669 'T'
+    0xFF, 0xFF, 0xFC, 0xCF, 0x33, 0xCC, 0xC3, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+    0x03, 0xF0, 0xFC,
+    // @684 'U'
+    0xF3, 0xFC, 0xF6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x19, 0x86, 0x61, 0x9C,
+    0xE3, 0xF0, 0x78,
+    // @699 'V'
+    0xF1, 0xFE, 0x3D, 0x83, 0x30, 0x63, 0x18, 0x63, 0x06, 0xC0, 0xD8, 0x1B,
+    0x01, 0xC0, 0x38, 0x07, 0x00,
+    // @716 'W'
+    0xF8, 0xFF, 0xC7, 0xD8, 0x0C, 0xCE, 0x66, 0x73, 0x33, 0x99, 0xB6, 0xC5,
+    0xB4, 0x38, 0xE1, 0xC7, 0x0E, 0x38, 0x60, 0xC0,
+    // @736 'X'
+    0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC1, 0xB0, 0x1C, 0x03, 0x80, 0xD8, 0x31,
+    0x8C, 0x1B, 0xC7, 0xF8, 0xF0,
+    // @753 'Y'
+    0xF3, 0xFC, 0xF6, 0x18, 0xCC, 0x1E, 0x07, 0x80, 0xC0, 0x30, 0x0C, 0x03,
+    0x03, 0xF0, 0xFC,
+    // @768 'Z'
+    0xFF, 0xFF, 0xC3, 0xC6, 0x0C, 0x18, 0x18, 0x30, 0x63, 0xC3, 0xFF, 0xFF,
+    // @780 '['
+    0xFF, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xFF,
+    // @788 '\\'
+    0xC0, 0xC0, 0x60, 0x60, 0x60, 0x30, 0x30, 0x18, 0x18, 0x0C, 0x0C, 0x06,
+    0x06, 0x06, 0x03, 0x03,
+    // @804 ']'
+    0xFF, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xFF,
+    // @812 '^'
+    0x08, 0x0E, 0x0D, 0x8C, 0x6C, 0x1C, 0x04,
+    // @819 '_'
+    0xFF, 0xFF, 0xFF, 0xF0,
+    // @823 '`'
+    0x86, 0x10,
+    // @825 'a'
+    0x3F, 0x1F, 0xE0, 0x18, 0xFE, 0x7F, 0xB8, 0x6C, 0x3B, 0xFF, 0x7D, 0xC0,
+    // @837 'b'
+    0xE0, 0x1C, 0x01, 0x80, 0x30, 0x06, 0xF0, 0xFF, 0x9C, 0x33, 0x03, 0x60,
+    0x6C, 0x0D, 0xC3, 0x7F, 0xEE, 0xF0,
+    // @855 'c'
+    0x1E, 0xDF, 0xF6, 0x0F, 0x03, 0xC0, 0x30, 0x0E, 0x0D, 0xFF, 0x3F, 0x00,
+    // @867 'd'
+    0x01, 0xC0, 0x38, 0x03, 0x00, 0x61, 0xEC, 0xFF, 0x98, 0x76, 0x06, 0xC0,
+    0xD8, 0x1B, 0x87, 0x3F, 0xF1, 0xEE,
+    // @885 'e'
+    0x1E, 0x1F, 0xE6, 0x1B, 0xFF, 0xFF, 0xF0, 0x06, 0x0D, 0xFF, 0x1F, 0x00,
+    // @897 'f'
+    0x1F, 0x9F, 0xCC, 0x06, 0x0F, 0xF7, 0xF8, 0xC0, 0x60, 0x30, 0x18, 0x0C,
+    0x1F, 0xEF, 0xF0,
+    // @912 'g'
+    0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E,
+    0xC0, 0x18, 0x07, 0x1F, 0xC3, 0xF0,
+    // @930 'h'
+    0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x1F, 0xE7, 0x19, 0x86, 0x61, 0x98,
+    0x66, 0x1B, 0xCF, 0xF3, 0xC0,
+    // @947 'i'
+    0x18, 0x18, 0x00, 0x00, 0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+    0xFF,
+    // @960 'j'
+    0x0C, 0x0C, 0x00, 0x00, 0x7F, 0x7F, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03,
+    0x03, 0x03, 0x07, 0xFE, 0xFC,
+    // @977 'k'
+    0xE0, 0x38, 0x06, 0x01, 0x80, 0x6F, 0x9B, 0xE6, 0xC1, 0xE0, 0x78, 0x1B,
+    0x06, 0x63, 0x9F, 0xE7, 0xC0,
+    // @994 'l'
+    0xF8, 0xF8, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0xFF,
+    0xFF,
+    // @1007 'm'
+    0xFD, 0xCF, 0xFE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x6F, 0x77,
+    0xF7, 0x70,
+    // @1021 'n'
+    0xEF, 0x3F, 0xE7, 0x19, 0x86, 0x61, 0x98, 0x66, 0x1B, 0xCF, 0xF3, 0xC0,
+    // @1033 'o'
+    0x1E, 0x1F, 0xE6, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x19, 0xFE, 0x1E, 0x00,
+    // @1045 'p'
+    0xEF, 0x1F, 0xF9, 0xC3, 0x30, 0x36, 0x06, 0xC0, 0xDC, 0x33, 0xFE, 0x6F,
+    0x0C, 0x01, 0x80, 0x7C, 0x0F, 0x80,
+    // @1063 'q'
+    0x1E, 0xEF, 0xFD, 0x87, 0x60, 0x6C, 0x0D, 0x81, 0x98, 0x73, 0xFE, 0x1E,
+    0xC0, 0x18, 0x03, 0x01, 0xF0, 0x3E,
+    // @1081 'r'
+    0xF3, 0xBD, 0xF3, 0xCC, 0xE0, 0x30, 0x0C, 0x03, 0x03, 0xFC, 0xFF, 0x00,
+    // @1093 's'
+    0x3F, 0xFF, 0xC3, 0xF0, 0x7E, 0x0F, 0xC3, 0xFF, 0xFC,
+    // @1102 't'
+    0x30, 0x0C, 0x03, 0x03, 0xFE, 0xFF, 0x8C, 0x03, 0x00, 0xC0, 0x30, 0x0C,
+    0x33, 0xFC, 0x7C,
+    // @1117 'u'
+    0xE3, 0xB8, 0xE6, 0x19, 0x86, 0x61, 0x98, 0x66, 0x39, 0xFF, 0x3D, 0xC0,
+    // @1129 'v'
+    0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x06, 0xC0, 0x70, 0x0E,
+    0x00,
+    // @1142 'w'
+    0xF1, 0xFE, 0x3D, 0x93, 0x32, 0x66, 0xFC, 0x77, 0x0E, 0xE1, 0x8C, 0x31,
+    0x80,
+    // @1155 'x'
+    0xF3, 0xFC, 0xF3, 0x30, 0x78, 0x0C, 0x07, 0x83, 0x33, 0xCF, 0xF3, 0xC0,
+    // @1167 'y'
+    0xF1, 0xFE, 0x3D, 0x83, 0x18, 0xC3, 0x18, 0x36, 0x07, 0xC0, 0x70, 0x0C,
+    0x01, 0x80, 0x60, 0x7F, 0x0F, 0xE0,
+    // @1185 'z'
+    0xFF, 0xFF, 0xC6, 0x0C, 0x18, 0x30, 0x63, 0xFF, 0xFF,
+    // @1194 '{'
+    0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x1C, 0xE1, 0xC3, 0x0C, 0x30, 0xC3, 0xC7,
+    // @1206 '|'
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // @1210 '}'
+    0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0E, 0x1C, 0xE3, 0x0C, 0x30, 0xCF, 0x38,
+    // @1222 '~'
+    0x38, 0x3F, 0x3C, 0xFC, 0x1E,
+};
+
+static constexpr u16 Font20Packed_Offsets[] = {
+    0,
+    0,
+    5,
+    11,
+    31,
+    47,
+    62,
+    75,
+    78,
+    86,
+    94,
+    103,
+    116,
+    119,
+    122,
+    124,
+    140,
+    155,
+    168,
+    183,
+    200,
+    215,
+    230,
+    245,
+    260,
+    275,
+    290,
+    294,
+    301,
+    317,
+    326,
+    342,
+    354,
+    367,
+    385,
+    400,
+    415,
+    432,
+    447,
+    462,
+    479,
+    494,
+    506,
+    523,
+    540,
+    555,
+    573,
+    588,
+    603,
+    618,
+    637,
+    654,
+    669,
+    684,
+    699,
+    716,
+    736,
+    753,
+    768,
+    780,
+    788,
+    804,
+    812,
+    819,
+    823,
+    825,
+    837,
+    855,
+    867,
+    885,
+    897,
+    912,
+    930,
+    947,
+    960,
+    977,
+    994,
+    1007,
+    1021,
+    1033,
+    1045,
+    1063,
+    1081,
+    1093,
+    1102,
+    1117,
+    1129,
+    1142,
+    1155,
+    1167,
+    1185,
+    1194,
+    1206,
+    1210,
+    1222,
+};
+
+static constexpr GlyphBox Font20Packed_Boxes[] = {
+    {20, 0, 14, 0},  // ' '
+    {1, 13, 5, 7},  // '!'
+    {2, 7, 3, 10},  // '"'
+    {0, 15, 2, 11},  // '#'
+    {0, 15, 3, 10},  // '$'
+    {1, 13, 2, 10},  // '%'
+    {3, 13, 3, 11},  // '&'
+    {2, 7, 6, 8},  // "'"
+    {1, 16, 6, 9},  // '('
+    {1, 16, 4, 7},  // ')'
+    {1, 9, 3, 10},  // '*'
+    {3, 12, 2, 11},  // '+'
+    {11, 16, 5, 8},  // ','
+    {7, 8, 2, 10},  // '-'
+    {11, 13, 6, 8},  // '.'
+    {0, 15, 3, 10},  // '/'
+    {1, 13, 2, 10},  // '0'
+    {1, 13, 3, 10},  // '1'
+    {1, 13, 2, 10},  // '2'
+    {1, 13, 1, 10},  // '3'
+    {1, 13, 2, 10},  // '4'
+    {1, 13, 2, 10},  // '5'
+    {1, 13, 2, 10},  // '6'
+    {1, 13, 2, 10},  // '7'
+    {1, 13, 2, 10},  // '8'
+    {1, 13, 2, 10},  // '9'
+    {5, 13, 6, 8},  // ':'
+    {5, 15, 5, 9},  // ';'
+    {3, 13, 1, 11},  // '<'
+    {5, 10, 1, 11},  // '='
+    {3, 13, 2, 12},  // '>'
+    {2, 13, 3, 10},  // '?'
+    {1, 14, 3, 9},  // '@'
+    {2, 13, 1, 12},  // 'A'
+    {2, 13, 2, 11},  // 'B'
+    {2, 13, 2, 11},  // 'C'
+    {2, 13, 1, 11},  // 'D'
+    {2, 13, 2, 11},  // 'E'
+    {2, 13, 2, 11},  // 'F'
+    {2, 13, 2, 12},  // 'G'
+    {2, 13, 2, 11},  // 'H'
+    {2, 13, 3, 10},  // 'I'
+    {2, 13, 2, 12},  // 'J'
+    {2, 13, 2, 12},  // 'K'
+    {2, 13, 2, 11},  // 'L'
+    {2, 13, 1, 12},  // 'M'
+    {2, 13, 2, 11},  // 'N'
+    {2, 13, 2, 11},  // 'O'
+    {2, 13, 2, 11},  // 'P'
+    {2, 16, 2, 11},  // 'Q'
+    {2, 13, 2, 12},  // 'R'
+    {2, 13, 2, 11},  // 'S'
+    {2, 13, 2, 11},  // 'T'
+    {2, 13, 2, 11},  // 'U'
+    {2, 13, 1, 11},  // 'V'
+    {2, 13, 1, 13},  // 'W'
+    {2, 13, 1, 11},  // 'X'
+    {2, 13, 2, 11},  // 'Y'
+    {2, 13, 3, 10},  // 'Z'
+    {1, 16, 6, 9},  // '['
+    {0, 15, 3, 10},  // '\\'
+    {1, 16, 4, 7},  // ']'
+    {1, 6, 2, 10},  // '^'
+    {18, 19, 0, 13},  // '_'
+    {1, 3, 5, 8},  // '`'
+    {5, 13, 2, 11},  // 'a'
+    {1, 13, 1, 11},  // 'b'
+    {5, 13, 2, 11},  // 'c'
+    {1, 13, 2, 12},  // 'd'
+    {5, 13, 2, 11},  // 'e'
+    {1, 13, 3, 11},  // 'f'
+    {5, 17, 2, 12},  // 'g'
+    {1, 13, 2, 11},  // 'h'
+    {1, 13, 3, 10},  // 'i'
+    {1, 17, 2, 9},  // 'j'
+    {1, 13, 2, 11},  // 'k'
+    {1, 13, 3, 10},  // 'l'
+    {5, 13, 1, 12},  // 'm'
+    {5, 13, 2, 11},  // 'n'
+    {5, 13, 2, 11},  // 'o'
+    {5, 17, 1, 11},  // 'p'
+    {5, 17, 2, 12},  // 'q'
+    {5, 13, 2, 11},  // 'r'
+    {5, 13, 3, 10},  // 's'
+    {2, 13, 2, 11},  // 't'
+    {5, 13, 2, 11},  // 'u'
+    {5, 13, 1, 11},  // 'v'
+    {5, 13, 1, 11},  // 'w'
+    {5, 13, 2, 11},  // 'x'
+    {5, 17, 1, 11},  // 'y'
+    {5, 13, 3, 10},  // 'z'
+    {1, 16, 4, 9},  // '{'
+    {1, 16, 6, 7},  // '|'
+    {1, 16, 3, 8},  // '}'
+    {6, 9, 2, 11},  // '~'
+};
+
+// Declared extern first, a constexpr variable alone has internal linkage
+extern const PackedFont Font20Packed;
+constexpr PackedFont Font20Packed = {
+    .data = Font20Packed_Data,
+    .Width = 14,
+    .Height = 20,
+    .Stride = (14 + 7) / 8,
+    .Count = 95,
+    .codes = nullptr,
+    .offsets = Font20Packed_Offsets,
+    .boxes = Font20Packed_Boxes,
+    .Fallback = 31,
+};
+
+}  // namespace pico_oled::font
@@ -2514,10 +2514,24 @@ static constexpr uint8_t Font24_Table[] = {
 };
 
 namespace pico_oled::font {
-pico_oled::font::Font Font24 = {
-    Font24_Table,
-    17,
-    24,
+static constexpr auto Font24_Boxes = make_glyph_boxes(Font24_Table, 17, 24);
+static constexpr auto Font24_Offsets = make_glyph_offsets(17, 24);
+#ifdef PICO_OLED_ROTATED_FONTS
+static constexpr auto Font24_Columns = make_glyph_columns<17, 24>(Font24_Table);
+#endif
+
+constexpr Font Font24 = {
+    .table = Font24_Table,
+    .Width = 17,
+    .Height = 24,
+    .Stride = (17 + 7) / 8,
+    .Count = GLYPH_COUNT,
+    .offsets = Font24_Offsets.data(),
+    .boxes = Font24_Boxes.data(),
+    .Fallback = FALLBACK_CHAR - FIRST_CHAR,
+#ifdef PICO_OLED_ROTATED_FONTS
+    .columns = Font24_Columns.data(),
+#endif
 };
 }
 
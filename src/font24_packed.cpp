@@ -0,0 +1,507 @@
+// Generated by tools/pack_font.py from src/font24.cpp, do not edit.
+
+#include "packed_font.hpp"
+
+namespace pico_oled::font {
+
+static constexpr u8 Font24Packed_Data[] = {
+    // @0 '!'
+    0xFF, 0xFF, 0xFF, 0xE9, 0x01, 0xF8,
+    // @6 '"'
+    0xE7, 0xE7, 0xE7, 0x42, 0x42, 0x42, 0x42,
+    // @13 '#'
+    0x19, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x99, 0xFF, 0xFF, 0xF8, 0xCC, 0x33,
+    0x1F, 0xFF, 0xFF, 0x99, 0x83, 0x30, 0x66, 0x0C, 0xC1, 0x98,
+    // @35 '$'
+    0x0C, 0x06, 0x0F, 0x6F, 0xFC, 0x3E, 0x1F, 0x80, 0xF8, 0x3F, 0x03, 0xF0,
+    0x7C, 0x3E, 0x3F, 0xFB, 0x78, 0x18, 0x0C, 0x06, 0x03, 0x00,
+    // @57 '%'
+    0x3C, 0x1F, 0x8E, 0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xFC, 0xFC, 0xFF, 0x8E,
+    0x73, 0x0C, 0xC3, 0x39, 0xC7, 0xE0, 0xF0,
+    // @76 '&'
+    0x1F, 0x87, 0xF1, 0x8C, 0x30, 0x06, 0x00, 0x60, 0x0E, 0x03, 0xE7, 0xEF,
+    0xF8, 0xF3, 0x0E, 0x3F, 0xF3, 0xEE,
+    // @94 "'"
+    0xFF, 0xA4, 0x90,
+    // @97 '('
+    0x0C, 0x73, 0x9E, 0x71, 0xCE, 0x38, 0xE3, 0x8E, 0x38, 0x71, 0xC3, 0x8E,
+    0x1C, 0x30,
+    // @111 ')'
+    0xC3, 0x87, 0x1C, 0x38, 0xE1, 0xC7, 0x1C, 0x71, 0xC7, 0x38, 0xE7, 0x9C,
+    0xE3, 0x00,
+    // @125 '*'
+    0x0C, 0x03, 0x00, 0xC3, 0xB7, 0xFF, 0xCF, 0xC1, 0xE0, 0x78, 0x33, 0x0C,
+    0xC0,
+    // @138 '+'
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+    // @156 ','
+    0x39, 0x9C, 0xC6, 0x63, 0x00,
+    // @161 '-'
+    0xFF, 0xFF, 0xF0,
+    // @164 '.'
+    0xFF, 0xF0,
+    // @166 '/'
+    0x00, 0xC0, 0x30, 0x1C, 0x06, 0x03, 0x80, 0xC0, 0x30, 0x18, 0x06, 0x03,
+    0x00, 0xC0, 0x60, 0x18, 0x0C, 0x03, 0x01, 0xC0, 0x60, 0x38, 0x0C, 0x03,
+    0x00,
+    // @191 '0'
+    0x1E, 0x0F, 0xC6, 0x19, 0x86, 0xC0, 0xF0, 0x3C, 0x0F, 0x03, 0xC0, 0xF0,
+    0x3C, 0x0D, 0x86, 0x61, 0x8F, 0xC1, 0xE0,
+    // @210 '1'
+    0x04, 0x0F, 0x0F, 0xC3, 0xB0, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+    0x00, 0xC0, 0x30, 0x0C, 0x3F, 0xFF, 0xFC,
+    // @229 '2'
+    0x1F, 0x0F, 0xFB, 0x83, 0x60, 0x3C, 0x06, 0x00, 0xC0, 0x30, 0x0C, 0x07,
+    0x01, 0xC0, 0x60, 0x18, 0x06, 0x01, 0xFF, 0xFF, 0xF8,
+    // @250 '3'
+    0x1E, 0x1F, 0xC6, 0x38, 0x06, 0x01, 0x80, 0xC1, 0xE0, 0x7C, 0x03, 0x80,
+    0x30, 0x0C, 0x03, 0xC1, 0xFF, 0xE7, 0xE0,
+    // @269 '4'
+    0x03, 0x80, 0xF0, 0x1E, 0x06, 0xC1, 0x98, 0x33, 0x0C, 0x61, 0x8C, 0x61,
+    0x98, 0x33, 0xFF, 0xFF, 0xF0, 0x18, 0x1F, 0xC3, 0xF8,
+    // @290 '5'
+    0x7F, 0xCF, 0xF9, 0x80, 0x30, 0x06, 0x00, 0xDE, 0x1F, 0xF3, 0x86, 0x00,
+    0x60, 0x0C, 0x01, 0x80, 0x3C, 0x0D, 0xFF, 0x8F, 0xC0,
+    // @311 '6'
+    0x07, 0xC7, 0xF3, 0x81, 0xC0, 0x60, 0x30, 0x0D, 0xE3, 0xFE, 0xE1, 0xB0,
+    0x3C, 0x0F, 0x03, 0x61, 0xDF, 0xE1, 0xF0,
+    // @330 '7'
+    0xFF, 0xFF, 0xFC, 0x0F, 0x07, 0x01, 0x80, 0x60, 0x38, 0x0C, 0x03, 0x01,
+    0xC0, 0x60, 0x18, 0x0E, 0x03, 0x00, 0xC0,
+    // @349 '8'
+    0x3F, 0x1F, 0xEE, 0x1F, 0x03, 0xC0, 0xD8, 0x63, 0xF0, 0xFC, 0x61, 0xB0,
+    0x3C, 0x0F, 0x03, 0xE1, 0xDF, 0xE3, 0xF0,
+    // @368 '9'
+    0x3E, 0x1F, 0xEE, 0x1B, 0x03, 0xC0, 0xF0, 0x36, 0x1D, 0xFF, 0x1E, 0xC0,
+    0x30, 0x18, 0x0E, 0x07, 0x3F, 0x8F, 0x80,
+    // @387 ':'
+    0xFF, 0xF0, 0x00, 0x00, 0xFF, 0xF0,
+    // @393 ';'
+    0x3C, 0xF3, 0xC0, 0x00, 0x00, 0x0E, 0x71, 0x86, 0x30, 0x80,
+    // @403 '<'
+    0x00, 0x1C, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00, 0xF0, 0x0F, 0x00,
+    0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x0F, 0x00, 0x1C,
+    // @426 '='
+    0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFC,
+    // @436 '>'
+    0xE0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03, 0xC0, 0x03,
+    0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x03, 0xC0, 0x3C, 0x00, 0xE0, 0x00,
+    // @459 '?'
+    0x3E, 0x3F, 0xB0, 0xF8, 0x3C, 0x18, 0x1C, 0x1C, 0x3C, 0x1C, 0x0C, 0x00,
+    0x00, 0x03, 0x81, 0xC0,
+    // @475 '@'
+    0x1F, 0x0F, 0xE7, 0x1D, 0x83, 0xC3, 0xF1, 0xFC, 0xEF, 0x33, 0xCC, 0xF3,
+    0x3C, 0x7F, 0x0F, 0xC0, 0x18, 0x07, 0x0C, 0xFF, 0x1F, 0x00,
+    // @497 'A'
+    0x1F, 0x80, 0x1F, 0xC0, 0x01, 0xC0, 0x03, 0x60, 0x03, 0x60, 0x06, 0x30,
+    0x06, 0x30, 0x0C, 0x30, 0x0F, 0xF8, 0x1F, 0xF8, 0x18, 0x0C, 0x30, 0x0C,
+    0xFC, 0x7F, 0xFC, 0x7F,
+    // @525 'B'
+    0xFF, 0xC7, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x03, 0x18, 0x38, 0xFF, 0x87,
+    0xFE, 0x30, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x3F, 0xFF, 0x7F, 0xF0,
+    // @548 'C'
+    0x0F, 0xB3, 0xFF, 0x70, 0x76, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0C, 0x00,
+    0xC0, 0x0C, 0x00, 0x60, 0x37, 0x07, 0x3F, 0xE0, 0xFC,
+    // @569 'D'
+    0xFF, 0x87, 0xFF, 0x0C, 0x1C, 0x60, 0x63, 0x01, 0x98, 0x0C, 0xC0, 0x66,
+    0x03, 0x30, 0x19, 0x80, 0xCC, 0x0C, 0x60, 0xEF, 0xFE, 0x7F, 0xE0,
+    // @592 'E'
+    0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0,
+    0x33, 0x03, 0x33, 0x30, 0x33, 0x03, 0xFF, 0xFF, 0xFF,
+    // @613 'F'
+    0xFF, 0xFF, 0xFF, 0x30, 0x33, 0x03, 0x33, 0x33, 0x30, 0x3F, 0x03, 0xF0,
+    0x33, 0x03, 0x30, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0,
+    // @634 'G'
+    0x0F, 0xB1, 0xFF, 0x9C, 0x1C, 0xC0, 0x6C, 0x03, 0x60, 0x03, 0x00, 0x18,
+    0x7F, 0xC3, 0xFE, 0x01, 0xB8, 0x0C, 0xE0, 0xE3, 0xFF, 0x07, 0xE0,
+    // @657 'H'
+    0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0xFF,
+    0x0F, 0xFC, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3,
+    0xF0,
+    // @682 'I'
+    0xFF, 0xFF, 0xF0, 0xC0, 0x30, 0x0C, 0x03, 0x00, 0xC0, 0x30, 0x0C, 0x03,
+    0x00, 0xC0, 0x30, 0xFF, 0xFF, 0xF0,
+    // @700 'J'
+    0x1F, 0xF8, 0xFF, 0xC0, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x18,
+    0x18, 0xC0, 0xC6, 0x06, 0x30, 0x31, 0x83, 0x0F, 0xF8, 0x1F, 0x00,
+    // @723 'K'
+    0xFE, 0x7D, 0xFC, 0xF8, 0xC1, 0x81, 0x86, 0x03, 0x18, 0x06, 0x60, 0x0D,
+    0xC0, 0x1F, 0xC0, 0x39, 0xC0, 0x61, 0xC0, 0xC1, 0x81, 0x83, 0x8F, 0xE3,
+    0xFF, 0xC7, 0xC0,
+    // @750 'L'
+    0xFF, 0x07, 0xF8, 0x06, 0x00, 0x30, 0x01, 0x80, 0x0C, 0x00, 0x60, 0x03,
+    0x00, 0x18, 0x18, 0xC0, 0xC6, 0x06, 0x30, 0x3F, 0xFF, 0xFF, 0xFC,
+    // @773 'M'
+    0xF0, 0x0F, 0xF8, 0x1F, 0x38, 0x1C, 0x3C, 0x3C, 0x3C, 0x3C, 0x36, 0x6C,
+    0x36, 0x6C, 0x33, 0xCC, 0x33, 0xCC, 0x31, 0x8C, 0x30, 0x0C, 0x30, 0x0C,
+    0xFE, 0x7F, 0xFE, 0x7F,
+    // @801 'N'
+    0xF1, 0xFF, 0xC7, 0xF3, 0x83, 0x0F, 0x0C, 0x3E, 0x30, 0xD8, 0xC3, 0x73,
+    0x0C, 0xEC, 0x31, 0xB0, 0xC7, 0xC3, 0x0F, 0x0C, 0x1C, 0xFE, 0x33, 0xF8,
+    0xC0,
+    // @826 'O'
+    0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03,
+    0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC0, 0xF0,
+    // @847 'P'
+    0xFF, 0xCF, 0xFE, 0x30, 0x73, 0x03, 0x30, 0x33, 0x03, 0x30, 0x63, 0xFE,
+    0x3F, 0x83, 0x00, 0x30, 0x03, 0x00, 0xFF, 0x0F, 0xF0,
+    // @868 'Q'
+    0x0F, 0x03, 0xFC, 0x70, 0xE6, 0x06, 0xE0, 0x7C, 0x03, 0xC0, 0x3C, 0x03,
+    0xC0, 0x3E, 0x07, 0x60, 0x67, 0x0E, 0x3F, 0xC1, 0xF0, 0x1F, 0x33, 0xFF,
+    0x30, 0xE0,
+    // @894 'R'
+    0xFF, 0xC3, 0xFF, 0x83, 0x07, 0x0C, 0x0C, 0x30, 0x30, 0xC1, 0xC3, 0xFE,
+    0x0F, 0xE0, 0x31, 0xC0, 0xC3, 0x83, 0x06, 0x0C, 0x1C, 0xFE, 0x3F, 0xF8,
+    0x70,
+    // @919 'S'
+    0x3E, 0xDF, 0xFE, 0x1F, 0x03, 0xC0, 0xFC, 0x07, 0xE0, 0x7E, 0x03, 0xF0,
+    0x3C, 0x0F, 0x87, 0xFF, 0xB7, 0xC0,
+    // @937 'T'
+    0xFF, 0xFF, 0xFF, 0xC6, 0x3C, 0x63, 0xC6, 0x3C, 0x63, 0x06, 0x00, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x3F, 0xC3, 0xFC,
+    // @958 'U'
+    0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+    0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x06, 0x18, 0x1F, 0xE0, 0x1E,
+    0x00,
+    // @983 'V'
+    0xFE, 0xFF, 0xFD, 0xFC, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x03, 0x06, 0x03,
+    0x18, 0x06, 0x30, 0x06, 0xC0, 0x0D, 0x80, 0x1B, 0x00, 0x1C, 0x00, 0x38,
+    0x00, 0x20, 0x00,
+    // @1010 'W'
+    0xFE, 0x3F, 0xFF, 0x1F, 0xCC, 0x01, 0x86, 0x00, 0xC3, 0x08, 0x60, 0xCE,
+    0x60, 0x67, 0x30, 0x36, 0xD8, 0x1B, 0x6C, 0x0F, 0x3E, 0x03, 0x8E, 0x01,
+    0xC7, 0x00, 0xC1, 0x80, 0x60, 0xC0,
+    // @1040 'X'
+    0xFC, 0xFF, 0xF3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x1E, 0x00, 0x30,
+    0x00, 0xC0, 0x07, 0x80, 0x33, 0x01, 0x86, 0x0C, 0x0C, 0xFC, 0xFF, 0xF3,
+    0xF0,
+    // @1065 'Y'
+    0xF8, 0xFF, 0xE3, 0xF3, 0x03, 0x06, 0x18, 0x0C, 0xC0, 0x33, 0x00, 0x78,
+    0x00, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x30, 0x00, 0xC0, 0x1F, 0xE0, 0x7F,
+    0x80,
+    // @1090 'Z'
+    0x7F, 0xEF, 0xFD, 0x81, 0xB0, 0x66, 0x18, 0xC6, 0x01, 0x80, 0x60, 0x18,
+    0x66, 0x0D, 0x81, 0xE0, 0x3F, 0xFF, 0xFF, 0xC0,
+    // @1110 '['
+    0xFF, 0xF1, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xFF, 0xC0,
+    // @1122 '\\'
+    0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C, 0x03, 0x00, 0x60, 0x18, 0x03,
+    0x00, 0xC0, 0x18, 0x06, 0x00, 0xC0, 0x30, 0x0E, 0x01, 0x80, 0x70, 0x0C,
+    0x03,
+    // @1147 ']'
+    0xFF, 0xC6, 0x31, 0x8C, 0x63, 0x18, 0xC6, 0x31, 0x8C, 0x63, 0xFF, 0xC0,
+    // @1159 '^'
+    0x04, 0x01, 0xC0, 0x7C, 0x1D, 0xC3, 0x18, 0xC1, 0xB0, 0x1C, 0x01,
+    // @1170 '_'
+    0xFF, 0xFF, 0xFF, 0xFF,
+    // @1174 '`'
+    0xC7, 0x0E, 0x30,
+    // @1177 'a'
+    0x3F, 0x07, 0xF8, 0x00, 0xC0, 0x0C, 0x1F, 0xC7, 0xFC, 0xE0, 0xCC, 0x0C,
+    0xC1, 0xC7, 0xFF, 0x3E, 0xF0,
+    // @1194 'b'
+    0xF0, 0x07, 0x80, 0x0C, 0x00, 0x60, 0x03, 0x7C, 0x1F, 0xF8, 0xE0, 0xC6,
+    0x03, 0x30, 0x19, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x83, 0x7F, 0xFB, 0xDF,
+    0x00,
+    // @1219 'c'
+    0x0F, 0xB3, 0xFF, 0x70, 0x7E, 0x03, 0xC0, 0x3C, 0x00, 0xC0, 0x0E, 0x03,
+    0x70, 0x73, 0xFE, 0x0F, 0xC0,
+    // @1236 'd'
+    0x01, 0xE0, 0x0F, 0x00, 0x18, 0x00, 0xC1, 0xF6, 0x3F, 0xF1, 0x83, 0x98,
+    0x0C, 0xC0, 0x66, 0x03, 0x30, 0x19, 0x80, 0xC6, 0x0E, 0x3F, 0xFC, 0x7D,
+    0xE0,
+    // @1261 'e'
+    0x1F, 0x87, 0xFE, 0x60, 0x6C, 0x03, 0xFF, 0xFF, 0xFF, 0xC0, 0x0C, 0x00,
+    0x60, 0x37, 0xFF, 0x1F, 0xC0,
+    // @1278 'f'
+    0x07, 0xF0, 0xFF, 0x18, 0x01, 0x80, 0xFF, 0xEF, 0xFE, 0x18, 0x01, 0x80,
+    0x18, 0x01, 0x80, 0x18, 0x01, 0x80, 0x18, 0x0F, 0xFC, 0xFF, 0xC0,
+    // @1301 'g'
+    0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98,
+    0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x70, 0xFF,
+    0x07, 0xE0,
+    // @1327 'h'
+    0xF0, 0x03, 0xC0, 0x03, 0x00, 0x0C, 0x00, 0x37, 0xC0, 0xFF, 0x83, 0x87,
+    0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x33, 0xF3,
+    0xFF, 0xCF, 0xC0,
+    // @1354 'i'
+    0x06, 0x00, 0x60, 0x00, 0x00, 0x00, 0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0,
+    // @1377 'j'
+    0x06, 0x03, 0x00, 0x00, 0x0F, 0xFF, 0xFC, 0x06, 0x03, 0x01, 0x80, 0xC0,
+    0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x81, 0xFF, 0xDF, 0x80,
+    // @1400 'k'
+    0xF0, 0x0F, 0x00, 0x30, 0x03, 0x00, 0x33, 0xE3, 0x3E, 0x33, 0x03, 0x60,
+    0x3E, 0x03, 0xC0, 0x3E, 0x03, 0x70, 0x33, 0x8F, 0x1F, 0xF1, 0xF0,
+    // @1423 'l'
+    0x7E, 0x07, 0xE0, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x00, 0x60,
+    0x06, 0x00, 0x60, 0x06, 0x00, 0x60, 0x06, 0x0F, 0xFF, 0xFF, 0xF0,
+    // @1446 'm'
+    0xF7, 0x78, 0xFF, 0xFC, 0x39, 0xCC, 0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C,
+    0x31, 0x8C, 0x31, 0x8C, 0x31, 0x8C, 0xFD, 0xEF, 0xFD, 0xEF,
+    // @1468 'n'
+    0xF7, 0xC3, 0xFF, 0x83, 0x87, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+    0x0C, 0x0C, 0x30, 0x33, 0xF3, 0xFF, 0xCF, 0xC0,
+    // @1488 'o'
+    0x0F, 0x03, 0xFC, 0x70, 0xEE, 0x07, 0xC0, 0x3C, 0x03, 0xC0, 0x3E, 0x07,
+    0x70, 0xE3, 0xFC, 0x0F, 0x00,
+    // @1505 'p'
+    0xF7, 0xC7, 0xFF, 0x8E, 0x0C, 0x60, 0x33, 0x01, 0x98, 0x0C, 0xC0, 0x66,
+    0x03, 0x38, 0x31, 0xFF, 0x8D, 0xF0, 0x60, 0x03, 0x00, 0x18, 0x03, 0xF8,
+    0x1F, 0xC0,
+    // @1531 'q'
+    0x1F, 0x7B, 0xFF, 0xD8, 0x39, 0x80, 0xCC, 0x06, 0x60, 0x33, 0x01, 0x98,
+    0x0C, 0x60, 0xE3, 0xFF, 0x07, 0xD8, 0x00, 0xC0, 0x06, 0x00, 0x30, 0x0F,
+    0xE0, 0x7F,
+    // @1557 'r'
+    0xF9, 0xEF, 0xBF, 0x1F, 0x31, 0xC0, 0x18, 0x01, 0x80, 0x18, 0x01, 0x80,
+    0x18, 0x0F, 0xFC, 0xFF, 0xC0,
+    // @1574 's'
+    0x3F, 0xDF, 0xFC, 0x0F, 0x03, 0xFC, 0x1F, 0xE0, 0x7F, 0x03, 0xC1, 0xFF,
+    0xEF, 0xF0,
+    // @1588 't'
+    0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0xFF, 0xCF, 0xFC, 0x30, 0x03, 0x00,
+    0x30, 0x03, 0x00, 0x30, 0x03, 0x00, 0x30, 0x71, 0xFF, 0x0F, 0xC0,
+    // @1611 'u'
+    0xF0, 0xF3, 0xC3, 0xC3, 0x03, 0x0C, 0x0C, 0x30, 0x30, 0xC0, 0xC3, 0x03,
+    0x0C, 0x0C, 0x30, 0x70, 0x7F, 0xF0, 0xFB, 0xC0,
+    // @1631 'v'
+    0xF8, 0x7F, 0xE1, 0xF3, 0x03, 0x0C, 0x0C, 0x18, 0x60, 0x61, 0x80, 0xCC,
+    0x03, 0x30, 0x0F, 0xC0, 0x1E, 0x00, 0x78, 0x00,
+    // @1651 'w'
+    0xF0, 0x7F, 0x83, 0xD8, 0x8C, 0xCE, 0x66, 0x73, 0x1A, 0xB0, 0xF7, 0x87,
+    0xBC, 0x38, 0xC0, 0xC6, 0x06, 0x30,
+    // @1669 'x'
+    0xF9, 0xFF, 0x9F, 0x30, 0xC1, 0x98, 0x0F, 0x00, 0x60, 0x0F, 0x01, 0x98,
+    0x30, 0xCF, 0x9F, 0xF9, 0xF0,
+    // @1686 'y'
+    0xFC, 0x3F, 0xF8, 0x7C, 0xC0, 0x60, 0xC1, 0x81, 0x83, 0x01, 0x8C, 0x03,
+    0x18, 0x03, 0x60, 0x07, 0xC0, 0x07, 0x00, 0x06, 0x00, 0x18, 0x00, 0x30,
+    0x00, 0xC0, 0x1F, 0xE0, 0x3F, 0xC0,
+    // @1716 'z'
+    0xFF, 0xFF, 0xFC, 0x1B, 0x0C, 0x06, 0x03, 0x01, 0x80, 0xC3, 0x60, 0xFF,
+    0xFF, 0xFC,
+    // @1730 '{'
+    0x1C, 0xF3, 0x0C, 0x30, 0xC3, 0x0C, 0x73, 0x87, 0x0C, 0x30, 0xC3, 0x0C,
+    0x3C, 0x70,
+    // @1744 '|'
+    0xFF, 0xFF, 0xFF, 0xFF, 0xF0,
+    // @1749 '}'
+    0xE3, 0xC3, 0x0C, 0x30, 0xC3, 0x0C, 0x38, 0x73, 0x8C, 0x30, 0xC3, 0x0C,
+    0xF3, 0x80,
+    // @1763 '~'
+    0x38, 0x0F, 0x8F, 0xBB, 0xE3, 0xE0, 0x38,
+};
+
+static constexpr u16 Font24Packed_Offsets[] = {
+    0,
+    0,
+    6,
+    13,
+    35,
+    57,
+    76,
+    94,
+    97,
+    111,
+    125,
+    138,
+    156,
+    161,
+    164,
+    166,
+    191,
+    210,
+    229,
+    250,
+    269,
+    290,
+    311,
+    330,
+    349,
+    368,
+    387,
+    393,
+    403,
+    426,
+    436,
+    459,
+    475,
+    497,
+    525,
+    548,
+    569,
+    592,
+    613,
+    634,
+    657,
+    682,
+    700,
+    723,
+    750,
+    773,
+    801,
+    826,
+    847,
+    868,
+    894,
+    919,
+    937,
+    958,
+    983,
+    1010,
+    1040,
+    1065,
+    1090,
+    1110,
+    1122,
+    1147,
+    1159,
+    1170,
+    1174,
+    1177,
+    1194,
+    1219,
+    1236,
+    1261,
+    1278,
+    1301,
+    1327,
+    1354,
+    1377,
+    1400,
+    1423,
+    1446,
+    1468,
+    1488,
+    1505,
+    1531,
+    1557,
+    1574,
+    1588,
+    1611,
+    1631,
+    1651,
+    1669,
+    1686,
+    1716,
+    1730,
+    1744,
+    1749,
+    1763,
+};
+
+static constexpr GlyphBox Font24Packed_Boxes[] = {
+    {24, 0, 17, 0},  // ' '
+    {2, 16, 6, 8},  // '!'
+    {3, 9, 4, 11},  // '"'
+    {2, 17, 2, 12},  // '#'
+    {1, 19, 3, 11},  // '$'
+    {2, 16, 3, 12},  // '%'
+    {4, 16, 3, 13},  // '&'
+    {3, 9, 6, 8},  // "'"
+    {2, 19, 7, 12},  // '('
+    {2, 19, 3, 8},  // ')'
+    {2, 11, 3, 12},  // '*'
+    {4, 15, 2, 13},  // '+'
+    {14, 20, 6, 10},  // ','
+    {9, 10, 3, 12},  // '-'
+    {14, 16, 6, 9},  // '.'
+    {0, 19, 3, 12},  // '/'
+    {2, 16, 3, 12},  // '0'
+    {2, 16, 3, 12},  // '1'
+    {2, 16, 2, 12},  // '2'
+    {2, 16, 3, 12},  // '3'
+    {2, 16, 2, 12},  // '4'
+    {2, 16, 2, 12},  // '5'
+    {2, 16, 3, 12},  // '6'
+    {2, 16, 3, 12},  // '7'
+    {2, 16, 3, 12},  // '8'
+    {2, 16, 3, 12},  // '9'
+    {6, 16, 6, 9},  // ':'
+    {6, 18, 6, 11},  // ';'
+    {4, 16, 0, 13},  // '<'
+    {7, 12, 1, 13},  // '='
+    {4, 16, 1, 14},  // '>'
+    {3, 16, 3, 11},  // '?'
+    {2, 18, 3, 12},  // '@'
+    {3, 16, 0, 15},  // 'A'
+    {3, 16, 1, 13},  // 'B'
+    {3, 16, 2, 13},  // 'C'
+    {3, 16, 1, 13},  // 'D'
+    {3, 16, 1, 12},  // 'E'
+    {3, 16, 2, 13},  // 'F'
+    {3, 16, 2, 14},  // 'G'
+    {3, 16, 1, 14},  // 'H'
+    {3, 16, 3, 12},  // 'I'
+    {3, 16, 2, 14},  // 'J'
+    {3, 16, 1, 15},  // 'K'
+    {3, 16, 1, 13},  // 'L'
+    {3, 16, 0, 15},  // 'M'
+    {3, 16, 1, 14},  // 'N'
+    {3, 16, 2, 13},  // 'O'
+    {3, 16, 2, 13},  // 'P'
+    {3, 19, 2, 13},  // 'Q'
+    {3, 16, 1, 14},  // 'R'
+    {3, 16, 3, 12},  // 'S'
+    {3, 16, 2, 13},  // 'T'
+    {3, 16, 1, 14},  // 'U'
+    {3, 16, 1, 15},  // 'V'
+    {3, 16, 0, 16},  // 'W'
+    {3, 16, 1, 14},  // 'X'
+    {3, 16, 1, 14},  // 'Y'
+    {3, 16, 2, 12},  // 'Z'
+    {2, 19, 7, 11},  // '['
+    {0, 19, 3, 12},  // '\\'
+    {2, 19, 4, 8},  // ']'
+    {1, 8, 3, 13},  // '^'
+    {22, 23, 0, 15},  // '_'
+    {1, 4, 6, 10},  // '`'
+    {6, 16, 2, 13},  // 'a'
+    {2, 16, 1, 13},  // 'b'
+    {6, 16, 2, 13},  // 'c'
+    {2, 16, 2, 14},  // 'd'
+    {6, 16, 2, 13},  // 'e'
+    {2, 16, 2, 13},  // 'f'
+    {6, 21, 2, 14},  // 'g'
+    {2, 16, 1, 14},  // 'h'
+    {2, 16, 2, 13},  // 'i'
+    {2, 21, 3, 11},  // 'j'
+    {2, 16, 2, 13},  // 'k'
+    {2, 16, 2, 13},  // 'l'
+    {6, 16, 0, 15},  // 'm'
+    {6, 16, 1, 14},  // 'n'
+    {6, 16, 2, 13},  // 'o'
+    {6, 21, 1, 13},  // 'p'
+    {6, 21, 2, 14},  // 'q'
+    {6, 16, 2, 13},  // 'r'
+    {6, 16, 3, 12},  // 's'
+    {2, 16, 2, 13},  // 't'
+    {6, 16, 1, 14},  // 'u'
+    {6, 16, 1, 14},  // 'v'
+    {6, 16, 1, 13},  // 'w'
+    {6, 16, 2, 13},  // 'x'
+    {6, 21, 1, 15},  // 'y'
+    {6, 16, 3, 12},  // 'z'
+    {2, 19, 5, 10},  // '{'
+    {2, 19, 7, 8},  // '|'
+    {2, 19, 5, 10},  // '}'
+    {8, 12, 2, 12},  // '~'
+};
+
+// Declared extern first, a constexpr variable alone has internal linkage
+extern const PackedFont Font24Packed;
+constexpr PackedFont Font24Packed = {
+    .data = Font24Packed_Data,
+    .Width = 17,
+    .Height = 24,
+    .Stride = (17 + 7) / 8,
+    .Count = 95,
+    .codes = nullptr,
+    .offsets = Font24Packed_Offsets,
+    .boxes = Font24Packed_Boxes,
+    .Fallback = 31,
+};
+
+}  // namespace pico_oled::font
@@ -995,10 +995,24 @@ static constexpr uint8_t _font_8_table[] = {
 };
 
 namespace pico_oled::font {
-Font Font8 = {
-    _font_8_table,
-    5,
-    8,
+static constexpr auto _font_8_boxes = make_glyph_boxes(_font_8_table, 5, 8);
+static constexpr auto _font_8_offsets = make_glyph_offsets(5, 8);
+#ifdef PICO_OLED_ROTATED_FONTS
+static constexpr auto _font_8_columns = make_glyph_columns<5, 8>(_font_8_table);
+#endif
+
+constexpr Font Font8 = {
+    .table = _font_8_table,
+    .Width = 5,
+    .Height = 8,
+    .Stride = (5 + 7) / 8,
+    .Count = GLYPH_COUNT,
+    .offsets = _font_8_offsets.data(),
+    .boxes = _font_8_boxes.data(),
+    .Fallback = FALLBACK_CHAR - FIRST_CHAR,
+#ifdef PICO_OLED_ROTATED_FONTS
+    .columns = _font_8_columns.data(),
+#endif
 };
 }
 
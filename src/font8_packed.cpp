@@ -0,0 +1,408 @@
+// Generated by tools/pack_font.py from src/font8.cpp, do not edit.
+
+#include "packed_font.hpp"
+
+namespace pico_oled::font {
+
+static constexpr u8 Font8Packed_Data[] = {
+    // @0 '!'
+    0xF4,
+    // @1 '"'
+    0xB4,
+    // @2 '#'
+    0x2A, 0xBE, 0xAF, 0xAA, 0x80,
+    // @7 '$'
+    0x4F, 0x33, 0x90,
+    // @10 '%'
+    0x44, 0x3C, 0x22,
+    // @13 '&'
+    0x74, 0xCA, 0xF0,
+    // @16 "'"
+    0xE0,
+    // @17 '('
+    0x6A, 0xA4,
+    // @19 ')'
+    0x95, 0x58,
+    // @21 '*'
+    0x5D, 0x50,
+    // @23 '+'
+    0x21, 0x3E, 0x42, 0x00,
+    // @27 ','
+    0x68,
+    // @28 '-'
+    0xE0,
+    // @29 '.'
+    0x80,
+    // @30 '/'
+    0x12, 0x22, 0x44, 0x80,
+    // @34 '0'
+    0x56, 0xDA, 0x80,
+    // @37 '1'
+    0x61, 0x08, 0x42, 0x7C,
+    // @41 '2'
+    0x55, 0x29, 0xC0,
+    // @44 '3'
+    0x54, 0xA3, 0x80,
+    // @47 '4'
+    0x26, 0xAF, 0x27,
+    // @50 '5'
+    0xF3, 0x1A, 0x80,
+    // @53 '6'
+    0x73, 0x5B, 0x80,
+    // @56 '7'
+    0xF4, 0xA4, 0x80,
+    // @59 '8'
+    0x55, 0x5A, 0x80,
+    // @62 '9'
+    0x76, 0xB3, 0x80,
+    // @65 ':'
+    0x90,
+    // @66 ';'
+    0x46,
+    // @67 '<'
+    0x12, 0xC2, 0x10,
+    // @70 '='
+    0xE3, 0x80,
+    // @72 '>'
+    0x84, 0x34, 0x80,
+    // @75 '?'
+    0x54, 0xA0, 0x80,
+    // @78 '@'
+    0x69, 0x9B, 0x98, 0x70,
+    // @82 'A'
+    0x61, 0x14, 0xE8, 0xEC,
+    // @86 'B'
+    0xF2, 0x5C, 0x94, 0xF8,
+    // @90 'C'
+    0xF6, 0x48, 0xC0,
+    // @93 'D'
+    0xF2, 0x52, 0x94, 0xF8,
+    // @97 'E'
+    0xFA, 0x58, 0x84, 0xFC,
+    // @101 'F'
+    0xFA, 0x58, 0x84, 0x70,
+    // @105 'G'
+    0xE8, 0x8B, 0xA6,
+    // @108 'H'
+    0xEA, 0x5E, 0x94, 0xF4,
+    // @112 'I'
+    0xE9, 0x25, 0xC0,
+    // @115 'J'
+    0x72, 0x2A, 0xA4,
+    // @118 'K'
+    0xDA, 0x98, 0xE5, 0x6C,
+    // @122 'L'
+    0xE2, 0x10, 0x84, 0xFC,
+    // @126 'M'
+    0xDE, 0xF7, 0x58, 0xEC,
+    // @130 'N'
+    0xDB, 0x5A, 0xB5, 0xF4,
+    // @134 'O'
+    0x69, 0x99, 0x96,
+    // @137 'P'
+    0xF2, 0x52, 0xE4, 0x70,
+    // @141 'Q'
+    0x69, 0x99, 0x96, 0x30,
+    // @145 'R'
+    0xF2, 0x52, 0xE4, 0xF4,
+    // @149 'S'
+    0xF5, 0x1B, 0xC0,
+    // @152 'T'
+    0xFD, 0x48, 0x42, 0x38,
+    // @156 'U'
+    0xDA, 0x52, 0x94, 0x98,
+    // @160 'V'
+    0xDC, 0x52, 0xA5, 0x18,
+    // @164 'W'
+    0xDC, 0x6B, 0x5A, 0xA8,
+    // @168 'X'
+    0xDA, 0x88, 0x45, 0x6C,
+    // @172 'Y'
+    0xDC, 0x54, 0x42, 0x38,
+    // @176 'Z'
+    0xF9, 0x24, 0x9F,
+    // @179 '['
+    0xEA, 0xAC,
+    // @181 '\\'
+    0x84, 0x42, 0x22, 0x10,
+    // @185 ']'
+    0xD5, 0x5C,
+    // @187 '^'
+    0x4A, 0x80,
+    // @189 '_'
+    0xF8,
+    // @190 '`'
+    0x90,
+    // @191 'a'
+    0x62, 0xEF,
+    // @193 'b'
+    0xC2, 0x1C, 0x94, 0xF8,
+    // @197 'c'
+    0xF2, 0x70,
+    // @199 'd'
+    0x31, 0x79, 0x97,
+    // @202 'e'
+    0xFE, 0x30,
+    // @204 'f'
+    0x2B, 0xA5, 0xC0,
+    // @207 'g'
+    0x79, 0x97, 0x16,
+    // @210 'h'
+    0xC2, 0x1C, 0x94, 0xF4,
+    // @214 'i'
+    0x43, 0x25, 0xC0,
+    // @217 'j'
+    0x43, 0x92, 0x4F,
+    // @220 'k'
+    0xC2, 0x16, 0xE5, 0x6C,
+    // @224 'l'
+    0xC9, 0x25, 0xC0,
+    // @227 'm'
+    0xD5, 0x6B, 0x50,
+    // @230 'n'
+    0xF2, 0x53, 0x90,
+    // @233 'o'
+    0x69, 0x96,
+    // @235 'p'
+    0xF2, 0x52, 0xE4, 0x70,
+    // @239 'q'
+    0x79, 0x97, 0x13,
+    // @242 'r'
+    0xF4, 0x4E,
+    // @244 's'
+    0x68, 0xE0,
+    // @246 't'
+    0x47, 0x90, 0x93, 0x00,
+    // @250 'u'
+    0xDA, 0x52, 0x70,
+    // @253 'v'
+    0xCA, 0x4C, 0x60,
+    // @256 'w'
+    0xDD, 0x6A, 0xA0,
+    // @259 'x'
+    0x96, 0x69,
+    // @261 'y'
+    0xDA, 0x94, 0x42, 0x30,
+    // @265 'z'
+    0xFA, 0x5F,
+    // @267 '{'
+    0x29, 0x64, 0x88,
+    // @270 '|'
+    0xFE,
+    // @271 '}'
+    0x89, 0x34, 0xA0,
+    // @274 '~'
+    0x5A,
+};
+
+static constexpr u16 Font8Packed_Offsets[] = {
+    0,
+    0,
+    1,
+    2,
+    7,
+    10,
+    13,
+    16,
+    17,
+    19,
+    21,
+    23,
+    27,
+    28,
+    29,
+    30,
+    34,
+    37,
+    41,
+    44,
+    47,
+    50,
+    53,
+    56,
+    59,
+    62,
+    65,
+    66,
+    67,
+    70,
+    72,
+    75,
+    78,
+    82,
+    86,
+    90,
+    93,
+    97,
+    101,
+    105,
+    108,
+    112,
+    115,
+    118,
+    122,
+    126,
+    130,
+    134,
+    137,
+    141,
+    145,
+    149,
+    152,
+    156,
+    160,
+    164,
+    168,
+    172,
+    176,
+    179,
+    181,
+    185,
+    187,
+    189,
+    190,
+    191,
+    193,
+    197,
+    199,
+    202,
+    204,
+    207,
+    210,
+    214,
+    217,
+    220,
+    224,
+    227,
+    230,
+    233,
+    235,
+    239,
+    242,
+    244,
+    246,
+    250,
+    253,
+    256,
+    259,
+    261,
+    265,
+    267,
+    270,
+    271,
+    274,
+};
+
+static constexpr GlyphBox Font8Packed_Boxes[] = {
+    {8, 0, 5, 0},  // ' '
+    {0, 5, 2, 2},  // '!'
+    {0, 1, 1, 3},  // '"'
+    {0, 6, 0, 4},  // '#'
+    {0, 6, 1, 3},  // '$'
+    {0, 5, 1, 4},  // '%'
+    {1, 5, 1, 4},  // '&'
+    {0, 2, 2, 2},  // "'"
+    {0, 6, 2, 3},  // '('
+    {0, 6, 1, 2},  // ')'
+    {0, 3, 1, 3},  // '*'
+    {1, 5, 0, 4},  // '+'
+    {4, 6, 2, 3},  // ','
+    {3, 3, 1, 3},  // '-'
+    {5, 5, 2, 2},  // '.'
+    {0, 6, 0, 3},  // '/'
+    {0, 5, 1, 3},  // '0'
+    {0, 5, 0, 4},  // '1'
+    {0, 5, 1, 3},  // '2'
+    {0, 5, 1, 3},  // '3'
+    {0, 5, 1, 4},  // '4'
+    {0, 5, 1, 3},  // '5'
+    {0, 5, 1, 3},  // '6'
+    {0, 5, 1, 3},  // '7'
+    {0, 5, 1, 3},  // '8'
+    {0, 5, 1, 3},  // '9'
+    {2, 5, 2, 2},  // ':'
+    {2, 5, 2, 3},  // ';'
+    {1, 5, 0, 3},  // '<'
+    {1, 3, 1, 3},  // '='
+    {1, 5, 1, 4},  // '>'
+    {0, 5, 1, 3},  // '?'
+    {0, 6, 1, 4},  // '@'
+    {0, 5, 0, 4},  // 'A'
+    {0, 5, 0, 4},  // 'B'
+    {0, 5, 1, 3},  // 'C'
+    {0, 5, 0, 4},  // 'D'
+    {0, 5, 0, 4},  // 'E'
+    {0, 5, 0, 4},  // 'F'
+    {0, 5, 1, 4},  // 'G'
+    {0, 5, 0, 4},  // 'H'
+    {0, 5, 1, 3},  // 'I'
+    {0, 5, 1, 4},  // 'J'
+    {0, 5, 0, 4},  // 'K'
+    {0, 5, 0, 4},  // 'L'
+    {0, 5, 0, 4},  // 'M'
+    {0, 5, 0, 4},  // 'N'
+    {0, 5, 1, 4},  // 'O'
+    {0, 5, 0, 4},  // 'P'
+    {0, 6, 1, 4},  // 'Q'
+    {0, 5, 0, 4},  // 'R'
+    {0, 5, 1, 3},  // 'S'
+    {0, 5, 0, 4},  // 'T'
+    {0, 5, 0, 4},  // 'U'
+    {0, 5, 0, 4},  // 'V'
+    {0, 5, 0, 4},  // 'W'
+    {0, 5, 0, 4},  // 'X'
+    {0, 5, 0, 4},  // 'Y'
+    {0, 5, 1, 4},  // 'Z'
+    {0, 6, 2, 3},  // '['
+    {0, 6, 0, 3},  // '\\'
+    {0, 6, 1, 2},  // ']'
+    {0, 2, 1, 3},  // '^'
+    {7, 7, 0, 4},  // '_'
+    {0, 1, 2, 3},  // '`'
+    {2, 5, 1, 4},  // 'a'
+    {0, 5, 0, 4},  // 'b'
+    {2, 5, 1, 3},  // 'c'
+    {0, 5, 1, 4},  // 'd'
+    {2, 5, 1, 3},  // 'e'
+    {0, 5, 1, 3},  // 'f'
+    {2, 7, 1, 4},  // 'g'
+    {0, 5, 0, 4},  // 'h'
+    {0, 5, 1, 3},  // 'i'
+    {0, 7, 1, 3},  // 'j'
+    {0, 5, 0, 4},  // 'k'
+    {0, 5, 1, 3},  // 'l'
+    {2, 5, 0, 4},  // 'm'
+    {2, 5, 0, 4},  // 'n'
+    {2, 5, 1, 4},  // 'o'
+    {2, 7, 0, 4},  // 'p'
+    {2, 7, 1, 4},  // 'q'
+    {2, 5, 1, 4},  // 'r'
+    {2, 5, 1, 3},  // 's'
+    {1, 5, 0, 4},  // 't'
+    {2, 5, 0, 4},  // 'u'
+    {2, 5, 0, 4},  // 'v'
+    {2, 5, 0, 4},  // 'w'
+    {2, 5, 1, 4},  // 'x'
+    {2, 7, 0, 4},  // 'y'
+    {2, 5, 1, 4},  // 'z'
+    {0, 6, 1, 3},  // '{'
+    {0, 6, 2, 2},  // '|'
+    {0, 6, 1, 3},  // '}'
+    {3, 4, 1, 4},  // '~'
+};
+
+// Declared extern first, a constexpr variable alone has internal linkage
+extern const PackedFont Font8Packed;
+constexpr PackedFont Font8Packed = {
+    .data = Font8Packed_Data,
+    .Width = 5,
+    .Height = 8,
+    .Stride = (5 + 7) / 8,
+    .Count = 95,
+    .codes = nullptr,
+    .offsets = Font8Packed_Offsets,
+    .boxes = Font8Packed_Boxes,
+    .Fallback = 31,
+};
+
+}  // namespace pico_oled::font
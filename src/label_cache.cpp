@@ -0,0 +1,140 @@
+#include "label_cache.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "fonts.hpp"
+#include "paint.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+using namespace pico_oled::paint;
+using pico_oled::Rect;
+
+namespace {
+
+/// ORs the first `Width` bits of `src` into `row`, starting at bit `Bit`
+auto put_bits(u8 *row, u32 Bit, const u8 *src, u16 Width) -> void {
+    const u32 bytes = (Width + 7u) / 8u;
+    const u32 shift = Bit % 8;
+    u8 *dst = row + Bit / 8;
+    for (u32 i = 0; i < bytes; i++) {
+        u8 bits = src[i];
+        if (i == bytes - 1) bits = static_cast<u8>(bits & (0xFFu << (bytes * 8 - Width)));
+
+        dst[i] = static_cast<u8>(dst[i] | bits >> shift);
+        // Bits spilling into the next byte are only ever within the row
+        const auto spill = static_cast<u8>(bits << (8 - shift));
+        if (shift != 0 && spill != 0) dst[i + 1] = static_cast<u8>(dst[i + 1] | spill);
+    }
+}
+
+}  // namespace
+
+LabelCache::LabelCache(std::span<u8> Arena)
+    : m_arena(Arena), m_used(0), m_entries(), m_count(0), m_clock(0) {}
+
+auto LabelCache::find(std::string_view Text, const font::Font &Font) -> Entry * {
+    for (u8 i = 0; i < this->m_count; i++) {
+        Entry &entry = this->m_entries[i];
+        if (entry.font != &Font || entry.length != Text.size()) continue;
+        if (std::memcmp(this->m_arena.data() + entry.offset, Text.data(), Text.size()) == 0)
+            return &entry;
+    }
+    return nullptr;
+}
+
+auto LabelCache::insert(std::string_view Text, const font::Font &Font) -> Entry * {
+    const u32 Width = static_cast<u32>(Text.size()) * Font.Width;
+    const Entry entry = {&Font,
+                         0,
+                         static_cast<u16>(Text.size()),
+                         static_cast<u16>((Width + 7) / 8),
+                         this->m_clock};
+    if (Text.size() > 0xFFFF || Width > 0xFFFF || entry.bytes() > this->m_arena.size())
+        return nullptr;
+
+    while (this->m_count == k_label_slots || this->m_used + entry.bytes() > this->m_arena.size())
+        this->evict();
+
+    Entry &added = this->m_entries[this->m_count++];
+    added = entry;
+    added.offset = this->m_used;
+    this->m_used += entry.bytes();
+
+    u8 *text = this->m_arena.data() + added.offset;
+    u8 *bitmap = text + added.length;
+    std::memcpy(text, Text.data(), Text.size());
+    std::memset(bitmap, 0, added.bitmap_bytes());
+
+    // Glyphs are laid side by side, each row of a glyph ORed into the label rows
+    for (u32 i = 0; i < Text.size(); i++) {
+        const u8 *glyph = Font.glyph(Text[i]);
+        for (u16 row = 0; row < Font.Height; row++) {
+            put_bits(bitmap + row * added.stride, i * Font.Width, glyph + row * Font.Stride,
+                     Font.Width);
+        }
+    }
+    return &added;
+}
+
+auto LabelCache::evict() -> void {
+    const auto oldest = std::min_element(
+        this->m_entries.begin(),
+        this->m_entries.begin() + this->m_count,
+        [](const Entry &a, const Entry &b) { return a.last_used < b.last_used; });
+    const u32 offset = oldest->offset;
+    const u32 bytes = oldest->bytes();
+
+    // Everything behind the label moves down over it
+    std::memmove(this->m_arena.data() + offset,
+                 this->m_arena.data() + offset + bytes,
+                 this->m_used - offset - bytes);
+    this->m_used -= bytes;
+    *oldest = this->m_entries[--this->m_count];
+    for (u8 i = 0; i < this->m_count; i++) {
+        if (this->m_entries[i].offset > offset) this->m_entries[i].offset -= bytes;
+    }
+}
+
+auto LabelCache::draw(Paint &paint,
+                      i32 Xpoint,
+                      i32 Ypoint,
+                      std::string_view Text,
+                      const font::Font &Font,
+                      eImageColors Color_Foreground,
+                      eImageColors Color_Background) -> Rect {
+    const i32 Width = static_cast<i32>(Text.size()) * Font.Width;
+    const Rect area = {static_cast<i16>(Xpoint),
+                       static_cast<i16>(Ypoint),
+                       static_cast<i16>(Xpoint + Width - 1),
+                       static_cast<i16>(Ypoint + Font.Height - 1)};
+    if (Text.empty()) return area;
+
+    Entry *entry = this->find(Text, Font);
+    if (entry == nullptr) entry = this->insert(Text, Font);
+    if (entry == nullptr) {
+        paint.draw_text(area, Text, Font, Color_Foreground, Color_Background);
+        return area;
+    }
+
+    entry->last_used = ++this->m_clock;
+    paint.draw_mask(this->m_arena.data() + entry->offset + entry->length,
+                    entry->stride,
+                    Xpoint,
+                    Ypoint,
+                    static_cast<u16>(Width),
+                    Font.Height,
+                    Color_Foreground,
+                    Color_Background);
+    return area;
+}
+
+auto LabelCache::clear() -> void {
+    this->m_count = 0;
+    this->m_used = 0;
+}
+
+auto LabelCache::used() const -> u32 { return this->m_used; }
+
+auto LabelCache::size() const -> u8 { return this->m_count; }
@@ -0,0 +1,98 @@
+#include "numeric_field.hpp"
+
+#include <algorithm>
+#include <array>
+#include <string_view>
+
+#include "dirty_rects.hpp"
+#include "number_format.hpp"
+#include "paint.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+using namespace pico_oled::paint;
+using pico_oled::DirtyRects;
+using pico_oled::Rect;
+
+namespace {
+
+using Cells = std::array<char, pico_oled::text::k_max_number_chars>;
+
+/// `Text` right aligned into `Width` cells behind spaces, '#' in every cell if it is too wide.
+/// Numbers arrive already padded to the width, so the pad character never shows up here.
+constexpr auto layout_cells(std::string_view Text, u8 Width) -> Cells {
+    Cells cells = {};
+    const bool overflow = Text.size() > Width;
+    const std::size_t padding = overflow ? 0 : Width - Text.size();
+    for (u8 i = 0; i < Width; i++) {
+        cells[i] = overflow ? '#' : i < padding ? ' ' : Text[i - padding];
+    }
+    return cells;
+}
+
+// "--" in a zero padded field leaves the leading cells blank, not "000--"
+static_assert(std::string_view(layout_cells("--", 5).data(), 5) == "   --");
+
+}  // namespace
+
+NumericField::NumericField(i32 Xstart,
+                           i32 Ystart,
+                           u8 Width,
+                           const font::Font &Font,
+                           eImageColors Color_Foreground,
+                           eImageColors Color_Background,
+                           u8 Decimals,
+                           char Pad)
+    : m_x(Xstart),
+      m_y(Ystart),
+      m_font(&Font),
+      m_foreground(Color_Foreground),
+      m_background(Color_Background),
+      m_width(std::min(Width, text::k_max_number_chars)),
+      m_decimals(std::min(Decimals, text::k_max_decimals)),
+      m_pad(Pad),
+      m_shown(),
+      m_valid(false) {}
+
+auto NumericField::cell(u8 Index) const -> Rect {
+    const i32 X = this->m_x + Index * this->m_font->Width;
+    return {static_cast<i16>(X),
+            static_cast<i16>(this->m_y),
+            static_cast<i16>(X + this->m_font->Width - 1),
+            static_cast<i16>(this->m_y + this->m_font->Height - 1)};
+}
+
+auto NumericField::draw(Paint &paint, i32 Value, DirtyRects &Dirty) -> bool {
+    const auto number = text::format_fixed(Value, this->m_decimals, this->m_width, this->m_pad);
+    return this->draw(paint, number.view(), Dirty);
+}
+
+auto NumericField::draw(Paint &paint, std::string_view Text, DirtyRects &Dirty) -> bool {
+    // A value too wide for the cells is not cut but masked
+    const Cells cells = layout_cells(Text, this->m_width);
+
+    bool drawn = false;
+    for (u8 i = 0; i < this->m_width; i++) {
+        if (this->m_valid && cells[i] == this->m_shown[i]) continue;
+
+        const Rect area = this->cell(i);
+        paint.draw_char(area.Xstart,
+                        area.Ystart,
+                        cells[i],
+                        *this->m_font,
+                        this->m_foreground,
+                        this->m_background);
+        Dirty.add(area);
+        this->m_shown[i] = cells[i];
+        drawn = true;
+    }
+    this->m_valid = true;
+    return drawn;
+}
+
+auto NumericField::invalidate() -> void { this->m_valid = false; }
+
+auto NumericField::bounds() const -> Rect {
+    if (this->m_width == 0) return {0, 0, -1, -1};
+    return this->cell(0).unite(this->cell(static_cast<u8>(this->m_width - 1)));
+}
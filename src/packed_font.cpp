@@ -0,0 +1,49 @@
+#include "packed_font.hpp"
+
+#include <algorithm>
+
+namespace pico_oled::font {
+
+auto decode_glyph(const PackedFont &Font, u16 index, u8 *rows) -> void {
+    std::fill_n(rows, Font.Stride * Font.Height, 0);
+
+    const auto &box = Font.boxes[index];
+    if (box.empty()) return;
+
+    const u8 *bits = Font.data + Font.offsets[index];
+    u32 bit = 0;
+    for (u32 Row = box.top; Row <= box.bottom; Row++) {
+        u8 *row = rows + Row * Font.Stride;
+        for (u32 Column = box.left; Column <= box.right; Column++, bit++) {
+            if (bits[bit / 8] & (0x80 >> (bit % 8)))
+                row[Column / 8] |= static_cast<u8>(0x80 >> (Column % 8));
+        }
+    }
+}
+
+auto GlyphCache::get(const PackedFont &Font, u16 index) -> const u8 * {
+    this->m_clock++;
+
+    Slot *victim = &this->m_slots[0];
+    for (auto &slot : this->m_slots) {
+        if (slot.font == &Font && slot.index == index) {
+            slot.used = this->m_clock;
+            return slot.rows.data();
+        }
+        // Never used slots have `used == 0` and go first
+        if (slot.used < victim->used) victim = &slot;
+    }
+
+    decode_glyph(Font, index, victim->rows.data());
+    victim->font = &Font;
+    victim->index = index;
+    victim->used = this->m_clock;
+    return victim->rows.data();
+}
+
+auto GlyphCache::clear() -> void {
+    this->m_slots = {};
+    this->m_clock = 0;
+}
+
+}  // namespace pico_oled::font
@@ -1,12 +1,17 @@
 #include "paint.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstdint>
+#include <cstdlib>
+#include <cstring>
 #include <limits>
 
 #include "Debug.hpp"
-#include "display.hpp"
+#include "buffer_kernels.hpp"
+#include "buffer_ops.hpp"
 #include "fonts.hpp"
+#include "imbuf.hpp"
 #include "paint_enums.hpp"
 #include "types.hpp"
 
@@ -23,30 +28,59 @@ auto Paint::create_image(u16 Width, u16 Height, eRotation rotation, eImageColors
     this->m_width_byte = (Width % 8 == 0) ? (Width / 8) : (Width / 8 + 1);
     this->m_height_byte = Height;
 
-    this->m_rotation = rotation;
     this->m_mirror = eMirrorOrientiation::MIRROR_NONE;
+    this->set_rotation(rotation);
+}
+
+auto Paint::select_image(pico_oled::ImBuf image) -> void { this->m_image_buf = image; }
+
+auto Paint::get_image() const -> const ImBuf & { return this->m_image_buf; }
+auto Paint::set_rotation(const eRotation rotation) -> void {
+    this->m_rotation = rotation;
 
     switch (this->m_rotation) {
         case eRotation::eROTATE_0:
         case eRotation::eROTATE_180: {
-            this->m_width = Width;
-            this->m_height = Height;
+            this->m_width = this->m_width_memory;
+            this->m_height = this->m_height_memory;
         } break;
 
         case eRotation::eROTATE_90:
         case eRotation::eROTATE_270: {
-            this->m_width = Height;
-            this->m_height = Width;
+            this->m_width = this->m_height_memory;
+            this->m_height = this->m_width_memory;
         } break;
     }
+
+    // The clip rectangles are in logical coordinates, which just changed meaning
+    this->m_clip = {0,
+                    0,
+                    static_cast<i16>(this->m_width - 1),
+                    static_cast<i16>(this->m_height - 1)};
+    this->m_clip_depth = 0;
 }
 
-auto Paint::select_image(pico_oled::ImBuf image) -> void { this->m_image_buf = image; }
+auto Paint::set_mirror_orientation(eMirrorOrientiation mirror) -> void { this->m_mirror = mirror; }
 
-auto Paint::get_image() const -> const ImBuf & { return this->m_image_buf; }
-auto Paint::set_rotation(const eRotation rotation) -> void { this->m_rotation = rotation; }
+auto Paint::push_clip(const Rect &clip) -> bool {
+    if (this->m_clip_depth == k_clip_depth) {
+        Debug("Clip stack exhausted\r\n");
+        return false;
+    }
+    this->m_clip_stack[this->m_clip_depth++] = this->m_clip;
+    this->m_clip = this->m_clip.intersect(clip);
+    return true;
+}
 
-auto Paint::set_mirror_orientation(eMirrorOrientiation mirror) -> void { this->m_mirror = mirror; }
+auto Paint::pop_clip() -> void {
+    if (this->m_clip_depth == 0) {
+        Debug("Clip stack is empty\r\n");
+        return;
+    }
+    this->m_clip = this->m_clip_stack[--this->m_clip_depth];
+}
+
+auto Paint::get_clip() const -> const Rect & { return this->m_clip; }
 
 auto Paint::set_scale(eScaling scale) -> void {
     this->m_scale = scale;
@@ -74,13 +108,7 @@ auto Paint::set_scale(eScaling scale) -> void {
     }
 }
 
-auto Paint::draw_pixel(u16 Xpoint, u16 Ypoint, eImageColors Color) -> void {
-    if (Xpoint > this->m_width || Ypoint > this->m_height) {
-        Debug("Exceeding display boundaries\r\n");
-        return;
-    }
-    u16 X, Y;
-
+auto Paint::to_memory(i32 Xpoint, i32 Ypoint, i32 &X, i32 &Y) const -> void {
     switch (this->m_rotation) {
         case eRotation::eROTATE_0: {
             X = Xpoint;
@@ -98,8 +126,6 @@ auto Paint::draw_pixel(u16 Xpoint, u16 Ypoint, eImageColors Color) -> void {
             X = Ypoint;
             Y = this->m_height_memory - Xpoint - 1;
         } break;
-        default:
-            return;
     }
 
     switch (this->m_mirror) {
@@ -115,14 +141,34 @@ auto Paint::draw_pixel(u16 Xpoint, u16 Ypoint, eImageColors Color) -> void {
             X = this->m_width_memory - X - 1;
             Y = this->m_height_memory - Y - 1;
         } break;
-        default:
-            return;
     }
+}
+
+auto Paint::to_memory_rect(const Rect &Area) const -> Rect {
+    if (Area.empty()) return Area;
 
-    if (X > this->m_width_memory || Y > this->m_height_memory) {
+    i32 X0, Y0, X1, Y1;
+    this->to_memory(Area.Xstart, Area.Ystart, X0, Y0);
+    this->to_memory(Area.Xend, Area.Yend, X1, Y1);
+    return {static_cast<i16>(std::min(X0, X1)),
+            static_cast<i16>(std::min(Y0, Y1)),
+            static_cast<i16>(std::max(X0, X1)),
+            static_cast<i16>(std::max(Y0, Y1))};
+}
+
+auto Paint::draw_pixel(i32 Xpoint, i32 Ypoint, eImageColors Color) -> void {
+    if (!this->m_clip.contains(Xpoint, Ypoint)) {
         Debug("Exceeding display boundaries\r\n");
         return;
     }
+    this->put_pixel(Xpoint, Ypoint, Color);
+}
+
+auto Paint::put_pixel(i32 Xpoint, i32 Ypoint, eImageColors Color) -> void {
+    i32 mem_x, mem_y;
+    this->to_memory(Xpoint, Ypoint, mem_x, mem_y);
+    const auto X = static_cast<u16>(mem_x);
+    const auto Y = static_cast<u16>(mem_y);
 
     switch (this->m_scale) {
         case eScaling::DOUBLE: {
@@ -158,6 +204,31 @@ auto Paint::draw_pixel(u16 Xpoint, u16 Ypoint, eImageColors Color) -> void {
     }
 }
 
+auto Paint::invert_pixel(i32 Xpoint, i32 Ypoint) -> void {
+    i32 mem_x, mem_y;
+    this->to_memory(Xpoint, Ypoint, mem_x, mem_y);
+    const auto X = static_cast<u16>(mem_x);
+    const auto Y = static_cast<u16>(mem_y);
+
+    switch (this->m_scale) {
+        case eScaling::DOUBLE:
+            this->m_image_buf[X / 8 + Y * this->m_width_byte] ^= static_cast<u8>(0x80 >> (X % 8));
+            break;
+        case eScaling::QUAD:
+            this->m_image_buf[X / 4 + Y * this->m_width_byte] ^=
+                static_cast<u8>(0xC0 >> ((X % 4) * 2));
+            break;
+        case eScaling::HEXDEC:
+            this->m_image_buf[X / 2 + Y * this->m_width_byte] ^=
+                static_cast<u8>(0xF0 >> ((X % 2) * 4));
+            break;
+        case eScaling::QW:
+            this->m_image_buf[X * 2 + Y * this->m_width_byte] ^= 0xFF;
+            this->m_image_buf[X * 2 + Y * this->m_width_byte + 1] ^= 0xFF;
+            break;
+    }
+}
+
 auto Paint::clear_color(eImageColors Color) -> void {
     /// numeric version of enum
     auto num_color = static_cast<u32>(Color);
@@ -165,12 +236,10 @@ auto Paint::clear_color(eImageColors Color) -> void {
     switch (this->m_scale) {
         case eScaling::DOUBLE:
         case eScaling::QUAD: {
-            for (u16 Y = 0; Y < this->m_height_byte; Y++) {
-                for (u16 X = 0; X < this->m_width_byte; X++) {  // 8 pixel =  1 byte
-                    u32 Addr = X + Y * this->m_width_byte;
-                    this->m_image_buf[Addr] = num_color;
-                }
-            }
+            // The rows are contiguous, so the image is one run of bytes filled word by word
+            buffer::fill(this->m_image_buf,
+                         static_cast<u8>(num_color),
+                         static_cast<u32>(this->m_width_byte) * this->m_height_byte);
         } break;
         case eScaling::HEXDEC: {
             for (u16 Y = 0; Y < this->m_height_byte; Y++) {
@@ -193,68 +262,656 @@ auto Paint::clear_color(eImageColors Color) -> void {
     }
 }
 
-auto Paint::ClearWindows(u16 Xstart, u16 Ystart, u16 Xend, u16 Yend, eImageColors Color) -> void {
-    for (u16 Y = Ystart; Y < Yend; Y++) {
-        for (u16 X = Xstart; X < Xend; X++) {  // 8 pixel =  1 byte
-            this->draw_pixel(X, Y, Color);
+auto Paint::ClearWindows(i32 Xstart, i32 Ystart, i32 Xend, i32 Yend, eImageColors Color) -> void {
+    if (Xstart >= Xend || Ystart >= Yend) return;
+    this->fill_rect(Xstart, Ystart, Xend - 1, Yend - 1, Color);
+}
+
+auto Paint::fill_rect_memory(u16 Xstart, u16 Ystart, u16 Xend, u16 Yend, eImageColors Color)
+    -> void {
+    const u16 first = Xstart / 8;
+    const u16 last = Xend / 8;
+    const auto left_mask = static_cast<u8>(0xFFu >> (Xstart % 8));
+    const auto right_mask = static_cast<u8>(0xFFu << (7 - Xend % 8));
+    const bool set = Color != eImageColors::BLACK;
+
+    for (u16 Y = Ystart; Y <= Yend; Y++) {
+        u8 *row = &this->m_image_buf[Y * this->m_width_byte];
+
+        if (first == last) {
+            const auto mask = static_cast<u8>(left_mask & right_mask);
+            row[first] = set ? row[first] | mask : row[first] & static_cast<u8>(~mask);
+            continue;
+        }
+
+        row[first] = set ? row[first] | left_mask : row[first] & static_cast<u8>(~left_mask);
+        for (u16 X = first + 1; X < last; X++) {
+            row[X] = set ? 0xFF : 0x00;
+        }
+        row[last] = set ? row[last] | right_mask : row[last] & static_cast<u8>(~right_mask);
+    }
+}
+
+auto Paint::fill_rect(i32 Xstart, i32 Ystart, i32 Xend, i32 Yend, eImageColors Color) -> void {
+    if (Xstart > Xend) std::swap(Xstart, Xend);
+    if (Ystart > Yend) std::swap(Ystart, Yend);
+
+    // Trimmed once here, everything below writes without further checks
+    Xstart = std::max<i32>(Xstart, this->m_clip.Xstart);
+    Ystart = std::max<i32>(Ystart, this->m_clip.Ystart);
+    Xend = std::min<i32>(Xend, this->m_clip.Xend);
+    Yend = std::min<i32>(Yend, this->m_clip.Yend);
+    if (Xstart > Xend || Ystart > Yend) return;
+
+    if (this->m_scale != eScaling::DOUBLE) {
+        for (i32 Y = Ystart; Y <= Yend; Y++) {
+            for (i32 X = Xstart; X <= Xend; X++) {
+                this->put_pixel(X, Y, Color);
+            }
+        }
+        return;
+    }
+
+    i32 X0, Y0, X1, Y1;
+    this->to_memory(Xstart, Ystart, X0, Y0);
+    this->to_memory(Xend, Yend, X1, Y1);
+    if (X0 > X1) std::swap(X0, X1);
+    if (Y0 > Y1) std::swap(Y0, Y1);
+
+    this->fill_rect_memory(static_cast<u16>(X0),
+                           static_cast<u16>(Y0),
+                           static_cast<u16>(X1),
+                           static_cast<u16>(Y1),
+                           Color);
+}
+
+auto Paint::scroll_region(const Rect &Area, i32 Dx, i32 Dy, eImageColors Fill) -> void {
+    const Rect area = Area.intersect(this->m_clip);
+    if (area.empty() || (Dx == 0 && Dy == 0)) return;
+    if (this->m_scale != eScaling::DOUBLE) {
+        Debug("scroll_region only supports 1 bpp images\r\n");
+        return;
+    }
+
+    // Rotation and mirroring are linear, so the shift maps like the difference of two points
+    const Rect mem = this->to_memory_rect(area);
+    i32 X0, Y0, X1, Y1;
+    this->to_memory(area.Xstart, area.Ystart, X0, Y0);
+    this->to_memory(area.Xstart + Dx, area.Ystart + Dy, X1, Y1);
+    const i32 mem_dx = X1 - X0;
+    const i32 mem_dy = Y1 - Y0;
+
+    if (std::abs(mem_dx) >= mem.width() || std::abs(mem_dy) >= mem.height()) {
+        // Nothing stays in the area
+        this->fill_rect_memory(static_cast<u16>(mem.Xstart),
+                               static_cast<u16>(mem.Ystart),
+                               static_cast<u16>(mem.Xend),
+                               static_cast<u16>(mem.Yend),
+                               Fill);
+        return;
+    }
+
+    this->scroll_memory(static_cast<u16>(mem.Xstart),
+                        static_cast<u16>(mem.Ystart),
+                        static_cast<u16>(mem.Xend),
+                        static_cast<u16>(mem.Yend),
+                        mem_dx,
+                        mem_dy);
+
+    // The rows, then the columns the shift uncovered
+    if (mem_dy != 0) {
+        const i32 top = mem_dy > 0 ? mem.Ystart : mem.Yend + mem_dy + 1;
+        this->fill_rect_memory(static_cast<u16>(mem.Xstart),
+                               static_cast<u16>(top),
+                               static_cast<u16>(mem.Xend),
+                               static_cast<u16>(top + std::abs(mem_dy) - 1),
+                               Fill);
+    }
+    if (mem_dx != 0) {
+        const i32 left = mem_dx > 0 ? mem.Xstart : mem.Xend + mem_dx + 1;
+        this->fill_rect_memory(static_cast<u16>(left),
+                               static_cast<u16>(mem.Ystart),
+                               static_cast<u16>(left + std::abs(mem_dx) - 1),
+                               static_cast<u16>(mem.Yend),
+                               Fill);
+    }
+}
+
+namespace {
+
+/// Writes bytes `First` to `Last` of the row `dst` with the bits of the row `src` moved `Dx`
+/// pixels to the right, bits outside the edge masks stay. Bits from beyond the row come in as
+/// 0. Bytes are written in the direction of the shift, so `src` may be `dst`.
+auto shift_row(u8 *dst,
+               const u8 *src,
+               i32 Row_bytes,
+               i32 First,
+               i32 Last,
+               u8 Left_mask,
+               u8 Right_mask,
+               i32 Dx) -> void {
+    const auto source = [&](i32 i) -> u32 { return i >= 0 && i < Row_bytes ? src[i] : 0u; };
+    // The source of every byte starts the same number of bits into a source byte
+    const i32 offset = -Dx;
+    const i32 skip = offset >= 0 ? offset / 8 : -((7 - offset) / 8);
+    const auto bit = static_cast<u32>(offset - skip * 8);
+
+    const auto write = [&](i32 b) {
+        const u32 bits = source(b + skip) << bit | source(b + skip + 1) >> (8 - bit);
+        u8 mask = 0xFF;
+        if (b == First) mask &= Left_mask;
+        if (b == Last) mask &= Right_mask;
+        dst[b] = static_cast<u8>((dst[b] & ~mask) | (bits & mask));
+    };
+
+    if (Dx > 0) {
+        for (i32 b = Last; b >= First; b--) write(b);
+    } else {
+        for (i32 b = First; b <= Last; b++) write(b);
+    }
+}
+
+}  // namespace
+
+auto Paint::scroll_memory(u16 Xstart, u16 Ystart, u16 Xend, u16 Yend, i32 Dx, i32 Dy) -> void {
+    const i32 row_bytes = this->m_width_byte;
+    const i32 first = Xstart / 8;
+    const i32 last = Xend / 8;
+    const auto left_mask = static_cast<u8>(0xFFu >> (Xstart % 8));
+    const auto right_mask = static_cast<u8>(0xFFu << (7 - Xend % 8));
+    const i32 moved = Yend - Ystart + 1 - std::abs(Dy);
+    u8 *image = this->m_image_buf.data();
+
+    if (Dx == 0 && first == 0 && last == row_bytes - 1 && left_mask == 0xFF &&
+        right_mask == 0xFF) {
+        // Whole rows, the moved ones are one run of bytes
+        const i32 to = Dy > 0 ? Ystart + Dy : Ystart;
+        std::memmove(image + to * row_bytes,
+                     image + (to - Dy) * row_bytes,
+                     static_cast<std::size_t>(moved * row_bytes));
+        return;
+    }
+
+    // Rows are taken from above when moving down, so those are written bottom up
+    const i32 step = Dy > 0 ? -1 : 1;
+    i32 Y = Dy > 0 ? Yend : Ystart;
+    for (i32 n = 0; n < moved; n++, Y += step) {
+        u8 *dst = image + Y * row_bytes;
+        const u8 *src = image + (Y - Dy) * row_bytes;
+        if (Dx == 0 && last - first > 1) {
+            // Only the edge bytes need masking
+            std::memmove(
+                dst + first + 1, src + first + 1, static_cast<std::size_t>(last - first - 1));
+            shift_row(dst, src, row_bytes, first, first, left_mask, 0xFF, 0);
+            shift_row(dst, src, row_bytes, last, last, 0xFF, right_mask, 0);
+        } else {
+            shift_row(dst, src, row_bytes, first, last, left_mask, right_mask, Dx);
         }
     }
 }
 
 auto Paint::draw_point(
-    u16 Xpoint, u16 Ypoint, eImageColors color, eDotSize epxsize, eDotStyle dot_style) -> void {
-    if (Xpoint > this->m_width || Ypoint > this->m_height) {
-        Debug("Paint_DrawPoint Input exceeds the normal display range\r\n");
-        printf("Xpoint = %d , this->m_width = %d  \r\n ", Xpoint, this->m_width);
-        printf("Ypoint = %d , this->m_height = %d  \r\n ", Ypoint, this->m_height);
+    i32 Xpoint, i32 Ypoint, eImageColors color, eDotSize epxsize, eDotStyle dot_style) -> void {
+    // DOT_FILL_AROUND covers a `2n-1` square from (x-n, y-n), DOT_FILL_RIGHTUP an `n` square
+    // from (x-1, y-1)
+    const auto dotsize = static_cast<i32>(epxsize);
+    const bool around = dot_style == eDotStyle::DOT_FILL_AROUND;
+    const i32 side = around ? 2 * dotsize - 1 : dotsize;
+    const i32 offset = around ? dotsize : 1;
+
+    this->stamp_dot(Xpoint - offset, Ypoint - offset, side, color);
+}
+
+namespace {
+
+/// Row masks of the square dots, indexed by side length and MSB aligned in the top byte. A dot
+/// is at most 15 pixels wide, so shifted to any bit offset it still fits into three bytes.
+constexpr auto k_dot_stamps = [] {
+    std::array<u32, 2 * static_cast<u32>(eDotSize::DOT_PIXEL_8X8)> stamps = {};
+    for (u32 side = 1; side < stamps.size(); side++) {
+        stamps[side] = ~0u << (32 - side);
+    }
+    return stamps;
+}();
+
+}  // namespace
+
+auto Paint::stamp_dot(i32 Xstart, i32 Ystart, i32 Side, eImageColors Color) -> void {
+    const i32 Xend = Xstart + Side - 1;
+    const i32 Yend = Ystart + Side - 1;
+
+    // Dots cut by the clip rectangle are trimmed by the generic rectangle fill
+    if (this->m_scale != eScaling::DOUBLE || !this->m_clip.contains(Xstart, Ystart) ||
+        !this->m_clip.contains(Xend, Yend)) {
+        this->fill_rect(Xstart, Ystart, Xend, Yend, Color);
         return;
     }
 
-    const auto dotsize = static_cast<int>(epxsize);
+    // A square stays a square of the same size in buffer space, only its corner moves
+    i32 X0, Y0, X1, Y1;
+    this->to_memory(Xstart, Ystart, X0, Y0);
+    this->to_memory(Xend, Yend, X1, Y1);
+    X0 = std::min(X0, X1);
+    Y0 = std::min(Y0, Y1);
+
+    const u32 bits = k_dot_stamps[static_cast<u32>(Side)] >> (X0 % 8);
+    const std::array<u8, 3> masks = {static_cast<u8>(bits >> 24),
+                                     static_cast<u8>(bits >> 16),
+                                     static_cast<u8>(bits >> 8)};
+    const auto bytes = static_cast<u32>((X0 % 8 + Side + 7) / 8);
+    const bool set = Color != eImageColors::BLACK;
+
+    u8 *row = &this->m_image_buf[static_cast<u32>(Y0 * this->m_width_byte + X0 / 8)];
+    for (i32 i = 0; i < Side; i++, row += this->m_width_byte) {
+        for (u32 b = 0; b < bytes; b++) {
+            row[b] = set ? row[b] | masks[b] : row[b] & static_cast<u8>(~masks[b]);
+        }
+    }
+}
+
+namespace {
+
+/// Position of a single pixel in a 1 bpp buffer
+struct BitCursor {
+    u8 *byte;
+    u8 mask;
+};
+
+/// Buffer-space move for one logical step: either a whole row or a single bit left/right
+struct BitStep {
+    i32 row;
+    i32 bit;
+};
+
+[[gnu::always_inline]] inline auto advance(BitCursor &cursor, const BitStep &step) -> void {
+    if (step.bit > 0) {
+        cursor.mask = static_cast<u8>(cursor.mask >> 1);
+        if (cursor.mask == 0) {
+            cursor.mask = 0x80;
+            cursor.byte++;
+        }
+    } else if (step.bit < 0) {
+        cursor.mask = static_cast<u8>(cursor.mask << 1);
+        if (cursor.mask == 0) {
+            cursor.mask = 0x01;
+            cursor.byte--;
+        }
+    } else {
+        cursor.byte += step.row;
+    }
+}
+
+[[gnu::always_inline]] inline auto plot(const BitCursor &cursor, bool set) -> void {
+    *cursor.byte = set ? *cursor.byte | cursor.mask : *cursor.byte & static_cast<u8>(~cursor.mask);
+}
+
+}  // namespace
+
+auto Paint::raster_line(i32 Xstart, i32 Ystart, i32 Xend, i32 Yend, eImageColors Color)
+    -> bool {
+    if (this->m_scale != eScaling::DOUBLE) return false;
+
+    // Axis aligned lines are one-pixel wide rectangles in buffer space
+    if (Xstart == Xend || Ystart == Yend) {
+        this->fill_rect(Xstart, Ystart, Xend, Yend, Color);
+        return true;
+    }
+
+    const i32 sx = Xstart < Xend ? 1 : -1;
+    const i32 sy = Ystart < Yend ? 1 : -1;
+    const i32 dx = std::abs(Xend - Xstart);
+    const i32 dy = std::abs(Yend - Ystart);
+    const bool x_major = dx >= dy;
+    const i32 major = x_major ? dx : dy;
+    const i32 minor = x_major ? dy : dx;
+
+    // The stamped walk puts pixel `n` of the line `n` steps along the major axis and
+    // `min(n, (2 * (n + lead) * minor + major) / (2 * major))` steps along the minor one, where
+    // lines that are wider than high look one pixel ahead. Those stop one pixel short of their
+    // end once they are steeper than 1:2. The clip rectangle is solved for `n` directly, so a
+    // clipped line keeps exactly the pixels it had unclipped.
+    const i32 lead = dx > dy ? 1 : 0;
+    i32 first = 0;
+    i32 last = lead != 0 && 2 * minor >= major ? major - 1 : major;
+
+    // Range of steps `k` that stay within `[lo, hi]` when walking from `origin` by `sign`
+    auto steps_within = [](i32 origin, i32 sign, i32 lo, i32 hi, i32 &k_lo, i32 &k_hi) {
+        k_lo = sign > 0 ? lo - origin : origin - hi;
+        k_hi = sign > 0 ? hi - origin : origin - lo;
+    };
+
+    i32 major_lo, major_hi, minor_lo, minor_hi;
+    const auto &clip = this->m_clip;
+    if (x_major) {
+        steps_within(Xstart, sx, clip.Xstart, clip.Xend, major_lo, major_hi);
+        steps_within(Ystart, sy, clip.Ystart, clip.Yend, minor_lo, minor_hi);
+    } else {
+        steps_within(Ystart, sy, clip.Ystart, clip.Yend, major_lo, major_hi);
+        steps_within(Xstart, sx, clip.Xstart, clip.Xend, minor_lo, minor_hi);
+    }
+    first = std::max(first, major_lo);
+    last = std::min(last, major_hi);
+    if (first > last) return true;
+
+    // The minor offset never decreases along the line, so the pixels leaving the clip on the
+    // minor axis are found by bisection. Only lines crossing the clip edge pay for it.
+    const i64 two_major = 2 * static_cast<i64>(major);
+    const i64 two_minor = 2 * static_cast<i64>(minor);
+    auto minor_at = [&](i32 n) {
+        const i64 target = (two_minor * (n + lead) + major) / two_major;
+        return static_cast<i32>(std::min<i64>(n, target));
+    };
+    // First pixel in `[lo, hi]` whose minor offset exceeds `limit`, `hi + 1` if there is none
+    auto first_beyond = [&](i32 lo, i32 hi, i32 limit) {
+        while (lo <= hi) {
+            const i32 mid = lo + (hi - lo) / 2;
+            if (minor_at(mid) > limit)
+                hi = mid - 1;
+            else
+                lo = mid + 1;
+        }
+        return lo;
+    };
+    if (minor_at(first) < minor_lo) first = first_beyond(first, last, minor_lo - 1);
+    if (first <= last && minor_at(last) > minor_hi) last = first_beyond(first, last, minor_hi) - 1;
+    if (first > last) return true;
+
+    // Walk state at the first visible pixel: the rounded target offset as a remainder, and how
+    // many minor steps the walk still lags behind it
+    i32 minor_steps = 0;
+    i32 behind = 0;
+    i32 error = 2 * minor * lead + major;
+    if (first != 0) {
+        const i64 start = two_minor * (first + lead) + major;
+        const i64 target = start / two_major;
+        error = static_cast<i32>(start - two_major * target);
+        minor_steps = static_cast<i32>(std::min<i64>(first, target));
+        behind = static_cast<i32>(target - minor_steps);
+    } else if (error >= 2 * major) {
+        error -= 2 * major;
+        behind = 1;
+    }
+
+    const i32 Xpoint = Xstart + sx * (x_major ? first : minor_steps);
+    const i32 Ypoint = Ystart + sy * (x_major ? minor_steps : first);
+    i32 X0, Y0;
+    this->to_memory(Xpoint, Ypoint, X0, Y0);
+
+    // Rotation and mirroring map a logical unit step onto a unit step in the buffer, so the
+    // transform is resolved once into the move for each axis.
+    auto step_for = [&](i32 step_x, i32 step_y) {
+        i32 X, Y;
+        this->to_memory(Xpoint + step_x, Ypoint + step_y, X, Y);
+        return BitStep{(Y - Y0) * this->m_width_byte, X - X0};
+    };
+    const BitStep major_step = x_major ? step_for(sx, 0) : step_for(0, sy);
+    const BitStep minor_step = x_major ? step_for(0, sy) : step_for(sx, 0);
+
+    BitCursor cursor = {&this->m_image_buf[static_cast<u32>(Y0 * this->m_width_byte + X0 / 8)],
+                        static_cast<u8>(0x80u >> (X0 % 8))};
+    const bool set = Color != eImageColors::BLACK;
+
+    // 45 degree lines advance on both axes every pixel
+    if (dx == dy) {
+        for (i32 n = first; n < last; n++) {
+            plot(cursor, set);
+            advance(cursor, major_step);
+            advance(cursor, minor_step);
+        }
+        plot(cursor, set);
+        return true;
+    }
 
-    if (dot_style == eDotStyle::DOT_FILL_AROUND) {
-        for (int XDir_Num = 0; XDir_Num < 2 * dotsize - 1; XDir_Num++) {
-            for (int YDir_Num = 0; YDir_Num < 2 * dotsize - 1; YDir_Num++) {
-                if (Xpoint + XDir_Num - dotsize < 0 || Ypoint + YDir_Num - dotsize < 0) break;
-                // printf("x = %d, y = %d\r\n", Xpoint + XDir_Num - eDotStyle::value(Dot_style),
-                // Ypoint + YDir_Num - eDotStyle::value(Dot_style));
-                this->draw_pixel(Xpoint + XDir_Num - dotsize, Ypoint + YDir_Num - dotsize, color);
+    for (i32 n = first; n < last; n++) {
+        plot(cursor, set);
+        advance(cursor, major_step);
+        error += 2 * minor;
+        if (error >= 2 * major) {
+            error -= 2 * major;
+            behind++;
+        }
+        if (behind > 0) {
+            behind--;
+            advance(cursor, minor_step);
+        }
+    }
+    plot(cursor, set);
+    return true;
+}
+
+namespace {
+
+/// Fixed point fraction bits used to place thick line polygons, 1/16th of a pixel
+constexpr i32 k_subpixel_bits = 4;
+constexpr i32 k_subpixel = 1 << k_subpixel_bits;
+
+auto isqrt(u32 value) -> u32 {
+    u32 root = 0;
+    u32 bit = 1u << 30;
+    while (bit > value) bit >>= 2;
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+auto floor_div(i32 num, i32 den) -> i32 {
+    return num >= 0 ? num / den : -((-num + den - 1) / den);
+}
+
+auto ceil_div(i32 num, i32 den) -> i32 { return -floor_div(-num, den); }
+
+/// Liang-Barsky clip of a segment against `[Xmin, Xmax] x [Ymin, Ymax]`, moving the endpoints
+/// onto the rectangle. Returns false if no part of the segment is inside.
+auto clip_segment(
+    i32 &Xstart, i32 &Ystart, i32 &Xend, i32 &Yend, i32 Xmin, i32 Ymin, i32 Xmax, i32 Ymax)
+    -> bool {
+    const i64 dx = static_cast<i64>(Xend) - Xstart;
+    const i64 dy = static_cast<i64>(Yend) - Ystart;
+
+    // Parameters as fractions `num / den` with a positive denominator
+    i64 enter_num = 0, enter_den = 1;
+    i64 leave_num = 1, leave_den = 1;
+
+    // Keeps the part of the segment where `p * t <= q`
+    auto edge = [&](i64 p, i64 q) {
+        if (p == 0) return q >= 0;
+        if (p < 0) {
+            if (-q * enter_den > enter_num * -p) {
+                enter_num = -q;
+                enter_den = -p;
             }
+        } else if (q * leave_den < leave_num * p) {
+            leave_num = q;
+            leave_den = p;
         }
+        return true;
+    };
+
+    if (!edge(-dx, static_cast<i64>(Xstart) - Xmin) || !edge(dx, Xmax - static_cast<i64>(Xstart)) ||
+        !edge(-dy, static_cast<i64>(Ystart) - Ymin) || !edge(dy, Ymax - static_cast<i64>(Ystart))) {
+        return false;
+    }
+    if (enter_num * leave_den > leave_num * enter_den) return false;
+
+    const i64 X0 = Xstart;
+    const i64 Y0 = Ystart;
+    Xstart = static_cast<i32>(X0 + dx * enter_num / enter_den);
+    Ystart = static_cast<i32>(Y0 + dy * enter_num / enter_den);
+    Xend = static_cast<i32>(X0 + dx * leave_num / leave_den);
+    Yend = static_cast<i32>(Y0 + dy * leave_num / leave_den);
+    return true;
+}
+
+}  // namespace
+
+auto Paint::fill_thick_line(i32 Xstart,
+                            i32 Ystart,
+                            i32 Xend,
+                            i32 Yend,
+                            i32 Half_width,
+                            eLineCap Line_Cap,
+                            eImageColors Color) -> void {
+    // The fixed point setup below needs coordinates within a few thousand pixels. Far away
+    // endpoints are first pulled onto the clip rectangle grown by more than the line width, so
+    // the caps stay out of sight.
+    constexpr i32 max_coordinate = 2048;
+    if (std::abs(Xstart) > max_coordinate || std::abs(Ystart) > max_coordinate ||
+        std::abs(Xend) > max_coordinate || std::abs(Yend) > max_coordinate) {
+        const i32 margin = Half_width + 2;
+        if (!clip_segment(Xstart,
+                          Ystart,
+                          Xend,
+                          Yend,
+                          this->m_clip.Xstart - margin,
+                          this->m_clip.Ystart - margin,
+                          this->m_clip.Xend + margin,
+                          this->m_clip.Yend + margin)) {
+            return;
+        }
+    }
+
+    const i32 dx = Xend - Xstart;
+    const i32 dy = Yend - Ystart;
+
+    // Axis aligned lines and single points with square ends are plain rectangles
+    if ((dx == 0 || dy == 0) && Line_Cap != eLineCap::LINE_CAP_ROUND) {
+        const i32 cap = Line_Cap == eLineCap::LINE_CAP_SQUARE || (dx == 0 && dy == 0) ? Half_width
+                                                                                      : 0;
+        const i32 grow_x = dx == 0 ? Half_width : cap;
+        const i32 grow_y = dy == 0 ? Half_width : cap;
+        this->fill_rect(std::min(Xstart, Xend) - grow_x,
+                        std::min(Ystart, Yend) - grow_y,
+                        std::max(Xstart, Xend) + grow_x,
+                        std::max(Ystart, Yend) + grow_y,
+                        Color);
         return;
     }
 
-    for (int XDir_Num = 0; XDir_Num < dotsize; XDir_Num++) {
-        for (int YDir_Num = 0; YDir_Num < dotsize; YDir_Num++) {
-            this->draw_pixel(Xpoint + XDir_Num - 1, Ypoint + YDir_Num - 1, color);
+    // Pixel centers sit on integer coordinates, so the polygon edges lie half a pixel beyond
+    // the outermost covered centers.
+    const i32 thickness = (2 * Half_width + 1) * k_subpixel / 2;
+    const auto length = static_cast<i32>(
+        isqrt(static_cast<u32>(dx * dx + dy * dy) << (2 * k_subpixel_bits)));
+
+    // Normal and (for square caps) tangent offsets, both `thickness` long
+    i32 nx = 0, ny = 0, tx = 0, ty = 0;
+    if (length != 0) {
+        nx = -dy * thickness * k_subpixel / length;
+        ny = dx * thickness * k_subpixel / length;
+        if (Line_Cap == eLineCap::LINE_CAP_SQUARE) {
+            tx = ny;
+            ty = -nx;
+        }
+    }
+
+    const i32 x0 = Xstart * k_subpixel;
+    const i32 y0 = Ystart * k_subpixel;
+    const i32 x1 = Xend * k_subpixel;
+    const i32 y1 = Yend * k_subpixel;
+    const std::array<std::array<i32, 2>, 4> quad = {{
+        {x0 + nx - tx, y0 + ny - ty},
+        {x1 + nx + tx, y1 + ny + ty},
+        {x1 - nx + tx, y1 - ny + ty},
+        {x0 - nx - tx, y0 - ny - ty},
+    }};
+
+    i32 top = quad[0][1];
+    i32 bottom = quad[0][1];
+    for (const auto &vertex : quad) {
+        top = std::min(top, vertex[1]);
+        bottom = std::max(bottom, vertex[1]);
+    }
+    i32 first_row = ceil_div(top, k_subpixel);
+    i32 last_row = floor_div(bottom, k_subpixel);
+
+    const bool round = Line_Cap == eLineCap::LINE_CAP_ROUND;
+    if (round) {
+        first_row = std::min(first_row, std::min(Ystart, Yend) - Half_width);
+        last_row = std::max(last_row, std::max(Ystart, Yend) + Half_width);
+    }
+    first_row = std::max<i32>(first_row, this->m_clip.Ystart);
+    last_row = std::min<i32>(last_row, this->m_clip.Yend);
+
+    // The shape is convex, so every row is the single span between the leftmost and rightmost
+    // crossing of its edges (and of the cap discs).
+    const i32 radius_sq = Half_width * Half_width + Half_width;
+    for (i32 row = first_row; row <= last_row; row++) {
+        const i32 yf = row * k_subpixel;
+        i32 left = std::numeric_limits<i32>::max();
+        i32 right = std::numeric_limits<i32>::min();
+
+        for (u32 i = 0; i < quad.size(); i++) {
+            const auto &a = quad[i];
+            const auto &b = quad[(i + 1) % quad.size()];
+            if (yf < std::min(a[1], b[1]) || yf > std::max(a[1], b[1])) continue;
+            if (a[1] == b[1]) {
+                left = std::min(left, ceil_div(std::min(a[0], b[0]), k_subpixel));
+                right = std::max(right, floor_div(std::max(a[0], b[0]), k_subpixel));
+                continue;
+            }
+            const i32 x = a[0] + (yf - a[1]) * (b[0] - a[0]) / (b[1] - a[1]);
+            left = std::min(left, ceil_div(x, k_subpixel));
+            right = std::max(right, floor_div(x, k_subpixel));
+        }
+
+        if (round) {
+            for (const auto &[cx, cy] : {std::array<i32, 2>{Xstart, Ystart}, {Xend, Yend}}) {
+                const i32 off = row - cy;
+                if (off * off > radius_sq) continue;
+                const auto half = static_cast<i32>(isqrt(static_cast<u32>(radius_sq - off * off)));
+                left = std::min(left, cx - half);
+                right = std::max(right, cx + half);
+            }
         }
+
+        if (left <= right) this->fill_span(left, right, row, Color);
     }
 }
 
-auto Paint::draw_line(u16 Xstart,
-                      u16 Ystart,
-                      u16 Xend,
-                      u16 Yend,
+auto Paint::draw_line(i32 Xstart,
+                      i32 Ystart,
+                      i32 Xend,
+                      i32 Yend,
                       eImageColors Color,
                       eDotSize Line_width,
-                      eLineStyle Line_Style) -> void {
-    if (Xstart > this->m_width || Ystart > this->m_height || Xend > this->m_width ||
-        Yend > this->m_height) {
-        Debug("Paint_DrawLine Input exceeds the normal display range\r\n");
+                      eLineStyle Line_Style,
+                      eLineCap Line_Cap) -> void {
+    // Thick lines cover the same `2n-1` wide band the dots used to be stamped along, centered
+    // on the dot grid.
+    if (Line_width != eDotSize::DOT_PIXEL_1X1) {
+        this->fill_thick_line(Xstart - 1,
+                              Ystart - 1,
+                              Xend - 1,
+                              Yend - 1,
+                              static_cast<i32>(Line_width) - 1,
+                              Line_Cap,
+                              Color);
         return;
     }
 
-    u16 Xpoint = Xstart;
-    u16 Ypoint = Ystart;
-    int dx = (int)Xend - (int)Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
-    int dy = (int)Yend - (int)Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
+    // Thin lines go straight to the buffer. A dotted line only ever swaps `Color` for its
+    // black/white equivalent, which is the same bit in a 1 bpp buffer. Dots are drawn up and
+    // left of their nominal point, the clip takes care of the ones falling off the image.
+    if (this->raster_line(Xstart - 1, Ystart - 1, Xend - 1, Yend - 1, Color)) return;
+
+    i32 Xpoint = Xstart;
+    i32 Ypoint = Ystart;
+    i32 dx = Xend - Xstart >= 0 ? Xend - Xstart : Xstart - Xend;
+    i32 dy = Yend - Ystart <= 0 ? Yend - Ystart : Ystart - Yend;
 
     // Increment direction, 1 is positive, -1 is counter;
-    int XAddway = Xstart < Xend ? 1 : -1;
-    int YAddway = Ystart < Yend ? 1 : -1;
+    i32 XAddway = Xstart < Xend ? 1 : -1;
+    i32 YAddway = Ystart < Yend ? 1 : -1;
 
     // Cumulative error
-    int Esp = dx + dy;
+    i32 Esp = dx + dy;
     char Dotted_Len = 0;
 
     for (;;) {
@@ -285,23 +942,22 @@ auto Paint::draw_line(u16 Xstart,
     }
 }
 
-auto Paint::draw_rectangle(u16 Xstart,
-                           u16 Ystart,
-                           u16 Xend,
-                           u16 Yend,
+auto Paint::draw_rectangle(i32 Xstart,
+                           i32 Ystart,
+                           i32 Xend,
+                           i32 Yend,
                            eImageColors Color,
                            eDotSize Line_width,
                            eDrawFilling Draw_Fill) -> void {
-    if (Xstart > this->m_width || Ystart > this->m_height || Xend > this->m_width ||
-        Yend > this->m_height) {
-        Debug("Input exceeds the normal display range\r\n");
-        return;
-    }
-
     if (Draw_Fill == eDrawFilling::DRAW_FILL_FULL) {
-        for (u16 Ypoint = Ystart; Ypoint < Yend; Ypoint++) {
-            this->draw_line(
-                Xstart, Ypoint, Xend, Ypoint, Color, Line_width, eLineStyle::LINE_STYLE_SOLID);
+        // Rows `Ystart..Yend-1` each drawn as a thick line on the dot grid merge into one block
+        if (Ystart < Yend) {
+            const i32 grow = static_cast<i32>(Line_width) - 1;
+            this->fill_rect(std::min(Xstart, Xend) - 1 - grow,
+                            Ystart - 1 - grow,
+                            std::max(Xstart, Xend) - 1 + grow,
+                            Yend - 2 + grow,
+                            Color);
         }
     } else {
         this->draw_line(
@@ -313,172 +969,394 @@ auto Paint::draw_rectangle(u16 Xstart,
     }
 }
 
-auto Paint::draw_circle(u16 X_Center,
-                        u16 Y_Center,
+namespace {
+
+/// Walks the midpoint circle of `Radius` and reports every row `0..Radius` of the disc exactly
+/// once as `(row, half_width)`, where the disc spans `[-half_width, half_width]` on that row.
+///
+/// The rows come in two runs: the ones below the diagonal while `XCurrent` advances, and the
+/// ones above it each time `YCurrent` is about to step down.
+template <typename F>
+auto for_each_disc_row(i32 Radius, F &&emit) -> void {
+    i32 XCurrent = 0;
+    i32 YCurrent = Radius;
+    i32 Esp = 3 - (Radius << 1);
+
+    while (XCurrent <= YCurrent) {
+        emit(XCurrent, YCurrent);
+        if (Esp < 0) {
+            Esp += 4 * XCurrent + 6;
+        } else {
+            if (YCurrent != XCurrent) emit(YCurrent, XCurrent);
+            Esp += 10 + 4 * (XCurrent - YCurrent);
+            YCurrent--;
+        }
+        XCurrent++;
+    }
+}
+
+}  // namespace
+
+auto Paint::fill_disc(i32 X_Center, i32 Y_Center, i32 Radius, eImageColors Color) -> void {
+    for_each_disc_row(Radius, [&](i32 row, i32 half_width) {
+        this->fill_span(X_Center - half_width, X_Center + half_width, Y_Center + row, Color);
+        if (row != 0)
+            this->fill_span(X_Center - half_width, X_Center + half_width, Y_Center - row, Color);
+    });
+}
+
+auto Paint::fill_ring(i32 X_Center, i32 Y_Center, i32 Inner, i32 Outer, eImageColors Color)
+    -> void {
+    // Half widths of the inner disc, only for the rows that can land in the clip rectangle. At
+    // most its height in consecutive distances from the center are visible.
+    constexpr auto max_rows = std::max(k_width, k_height);
+    std::array<i16, max_rows> inner_half = {};
+    const i32 first_row = Y_Center < this->m_clip.Ystart ? this->m_clip.Ystart - Y_Center
+                          : Y_Center > this->m_clip.Yend ? Y_Center - this->m_clip.Yend
+                                                         : 0;
+
+    for_each_disc_row(Inner, [&](i32 row, i32 half_width) {
+        if (row >= first_row && row - first_row < max_rows)
+            inner_half[static_cast<u32>(row - first_row)] = static_cast<i16>(half_width);
+    });
+
+    auto ring_row = [&](i32 Ypoint, i32 row, i32 half_width) {
+        if (row > Inner) {
+            this->fill_span(X_Center - half_width, X_Center + half_width, Ypoint, Color);
+            return;
+        }
+        if (row < first_row || row - first_row >= max_rows) return;
+        const i32 hole = inner_half[static_cast<u32>(row - first_row)];
+        this->fill_span(X_Center - half_width, X_Center - hole - 1, Ypoint, Color);
+        this->fill_span(X_Center + hole + 1, X_Center + half_width, Ypoint, Color);
+    };
+
+    for_each_disc_row(Outer, [&](i32 row, i32 half_width) {
+        ring_row(Y_Center + row, row, half_width);
+        if (row != 0) ring_row(Y_Center - row, row, half_width);
+    });
+}
+
+auto Paint::draw_circle(i32 X_Center,
+                        i32 Y_Center,
                         u16 Radius,
                         eImageColors Color,
                         eDotSize Line_width,
                         eDrawFilling Draw_Fill) -> void {
-    if (X_Center > this->m_width || Y_Center >= this->m_height) {
-        Debug("Paint_DrawCircle Input exceeds the normal display range\r\n");
+    // Dots are drawn up and left of their nominal point, keep the filled shapes on the same grid
+    const i32 dot_x = X_Center - 1;
+    const i32 dot_y = Y_Center - 1;
+    const auto dotsize = static_cast<i32>(Line_width);
+
+    if (Draw_Fill == eDrawFilling::DRAW_FILL_FULL) {
+        this->fill_disc(dot_x, dot_y, Radius, Color);
+        return;
+    }
+
+    // A thick outline is the difference of two discs, `dotsize - 1` pixels either side
+    if (dotsize > 1) {
+        this->fill_ring(dot_x, dot_y, Radius - dotsize, Radius + dotsize - 1, Color);
         return;
     }
 
     // Draw a circle from(0, R) as a starting point
-    int16_t XCurrent, YCurrent;
+    i32 XCurrent, YCurrent;
     XCurrent = 0;
     YCurrent = Radius;
 
     // Cumulative error,judge the next point of the logo
-    int16_t Esp = 3 - (Radius << 1);
+    i32 Esp = 3 - (static_cast<i32>(Radius) << 1);
+
+    while (XCurrent <= YCurrent) {
+        this->draw_point(X_Center + XCurrent,
+                         Y_Center + YCurrent,
+                         Color,
+                         Line_width,
+                         eDotStyle::DOT_FILL_DEFAULT);  // 1
+        this->draw_point(X_Center - XCurrent,
+                         Y_Center + YCurrent,
+                         Color,
+                         Line_width,
+                         eDotStyle::DOT_FILL_DEFAULT);  // 2
+        this->draw_point(X_Center - YCurrent,
+                         Y_Center + XCurrent,
+                         Color,
+                         Line_width,
+                         eDotStyle::DOT_FILL_DEFAULT);  // 3
+        this->draw_point(X_Center - YCurrent,
+                         Y_Center - XCurrent,
+                         Color,
+                         Line_width,
+                         eDotStyle::DOT_FILL_DEFAULT);  // 4
+        this->draw_point(X_Center - XCurrent,
+                         Y_Center - YCurrent,
+                         Color,
+                         Line_width,
+                         eDotStyle::DOT_FILL_DEFAULT);  // 5
+        this->draw_point(X_Center + XCurrent,
+                         Y_Center - YCurrent,
+                         Color,
+                         Line_width,
+                         eDotStyle::DOT_FILL_DEFAULT);  // 6
+        this->draw_point(X_Center + YCurrent,
+                         Y_Center - XCurrent,
+                         Color,
+                         Line_width,
+                         eDotStyle::DOT_FILL_DEFAULT);  // 7
+        this->draw_point(X_Center + YCurrent,
+                         Y_Center + XCurrent,
+                         Color,
+                         Line_width,
+                         eDotStyle::DOT_FILL_DEFAULT);  // 0
+
+        if (Esp < 0)
+            Esp += 4 * XCurrent + 6;
+        else {
+            Esp += 10 + 4 * (XCurrent - YCurrent);
+            YCurrent--;
+        }
+        XCurrent++;
+    }
+}
 
-    if (Draw_Fill == eDrawFilling::DRAW_FILL_FULL) {
-        while (XCurrent <= YCurrent) {  // Realistic circles
-            for (i16 sCountY = XCurrent; sCountY <= YCurrent; sCountY++) {
-                this->draw_point(X_Center + XCurrent,
-                                 Y_Center + sCountY,
-                                 Color,
-                                 eDotSize::DOT_PIXEL_DFT,
-                                 eDotStyle::DOT_FILL_DEFAULT);  // 1
-                this->draw_point(X_Center - XCurrent,
-                                 Y_Center + sCountY,
-                                 Color,
-                                 eDotSize::DOT_PIXEL_DFT,
-                                 eDotStyle::DOT_FILL_DEFAULT);  // 2
-                this->draw_point(X_Center - sCountY,
-                                 Y_Center + XCurrent,
-                                 Color,
-                                 eDotSize::DOT_PIXEL_DFT,
-                                 eDotStyle::DOT_FILL_DEFAULT);  // 3
-                this->draw_point(X_Center - sCountY,
-                                 Y_Center - XCurrent,
-                                 Color,
-                                 eDotSize::DOT_PIXEL_DFT,
-                                 eDotStyle::DOT_FILL_DEFAULT);  // 4
-                this->draw_point(X_Center - XCurrent,
-                                 Y_Center - sCountY,
-                                 Color,
-                                 eDotSize::DOT_PIXEL_DFT,
-                                 eDotStyle::DOT_FILL_DEFAULT);  // 5
-                this->draw_point(X_Center + XCurrent,
-                                 Y_Center - sCountY,
-                                 Color,
-                                 eDotSize::DOT_PIXEL_DFT,
-                                 eDotStyle::DOT_FILL_DEFAULT);  // 6
-                this->draw_point(X_Center + sCountY,
-                                 Y_Center - XCurrent,
-                                 Color,
-                                 eDotSize::DOT_PIXEL_DFT,
-                                 eDotStyle::DOT_FILL_DEFAULT);  // 7
-                this->draw_point(X_Center + sCountY,
-                                 Y_Center + XCurrent,
-                                 Color,
-                                 eDotSize::DOT_PIXEL_DFT,
-                                 eDotStyle::DOT_FILL_DEFAULT);
-            }
-            if (Esp < 0)
-                Esp += 4 * XCurrent + 6;
-            else {
-                Esp += 10 + 4 * (XCurrent - YCurrent);
-                YCurrent--;
-            }
-            XCurrent++;
-        }
-    } else {  // Draw a hollow circle
-        while (XCurrent <= YCurrent) {
-            this->draw_point(X_Center + XCurrent,
-                             Y_Center + YCurrent,
-                             Color,
-                             Line_width,
-                             eDotStyle::DOT_FILL_DEFAULT);  // 1
-            this->draw_point(X_Center - XCurrent,
-                             Y_Center + YCurrent,
-                             Color,
-                             Line_width,
-                             eDotStyle::DOT_FILL_DEFAULT);  // 2
-            this->draw_point(X_Center - YCurrent,
-                             Y_Center + XCurrent,
-                             Color,
-                             Line_width,
-                             eDotStyle::DOT_FILL_DEFAULT);  // 3
-            this->draw_point(X_Center - YCurrent,
-                             Y_Center - XCurrent,
-                             Color,
-                             Line_width,
-                             eDotStyle::DOT_FILL_DEFAULT);  // 4
-            this->draw_point(X_Center - XCurrent,
-                             Y_Center - YCurrent,
-                             Color,
-                             Line_width,
-                             eDotStyle::DOT_FILL_DEFAULT);  // 5
-            this->draw_point(X_Center + XCurrent,
-                             Y_Center - YCurrent,
-                             Color,
-                             Line_width,
-                             eDotStyle::DOT_FILL_DEFAULT);  // 6
-            this->draw_point(X_Center + YCurrent,
-                             Y_Center - XCurrent,
-                             Color,
-                             Line_width,
-                             eDotStyle::DOT_FILL_DEFAULT);  // 7
-            this->draw_point(X_Center + YCurrent,
-                             Y_Center + XCurrent,
-                             Color,
-                             Line_width,
-                             eDotStyle::DOT_FILL_DEFAULT);  // 0
-
-            if (Esp < 0)
-                Esp += 4 * XCurrent + 6;
-            else {
-                Esp += 10 + 4 * (XCurrent - YCurrent);
-                YCurrent--;
-            }
-            XCurrent++;
+namespace {
+
+/// Largest integer factor glyphs are scaled by
+constexpr u8 k_max_glyph_scale = 4;
+
+/// Each nibble with every bit repeated `Scale` times, MSB first in the low `4 * Scale` bits
+template <u32 Scale>
+constexpr auto make_nibble_expansion() -> std::array<u16, 16> {
+    std::array<u16, 16> table = {};
+    for (u32 nibble = 0; nibble < table.size(); nibble++) {
+        u32 bits = 0;
+        for (u32 bit = 0; bit < 4; bit++) {
+            const u32 set = (nibble >> (3 - bit)) & 1u;
+            bits = bits << Scale | (set ? (1u << Scale) - 1 : 0);
         }
+        table[nibble] = static_cast<u16>(bits);
+    }
+    return table;
+}
+
+constexpr std::array<std::array<u16, 16>, k_max_glyph_scale - 1> k_nibble_expansions = {
+    make_nibble_expansion<2>(), make_nibble_expansion<3>(), make_nibble_expansion<4>()};
+
+/// Widest glyph row once scaled, in bytes
+constexpr u32 k_max_scaled_row = (pico_oled::font::MAX_WIDTH_FONT * k_max_glyph_scale + 7) / 8;
+
+/// Widens the first `Width` pixels of a glyph row `Scale` times into `out`, whole bytes at a
+/// time. `Scale` is 2 to `k_max_glyph_scale`.
+auto expand_glyph_row(const u8 *row, u16 Width, u8 Scale, u8 *out) -> void {
+    const auto &table = k_nibble_expansions[Scale - 2u];
+    const u32 nibble_bits = 4u * Scale;
+    u32 acc = 0;
+    u32 bits = 0;
+    for (u32 nibble = 0; nibble * 4 < Width; nibble++) {
+        const u32 value = nibble % 2 ? row[nibble / 2] & 0x0Fu : row[nibble / 2] >> 4;
+        acc = acc << nibble_bits | table[value];
+        for (bits += nibble_bits; bits >= 8; bits -= 8) {
+            *out++ = static_cast<u8>(acc >> (bits - 8));
+        }
+    }
+    if (bits > 0) *out = static_cast<u8>(acc << (8 - bits));
+}
+
+/// How a 1 bpp bitmap is drawn in two colors with blits, which only light or clear pixels
+struct BitmapOps {
+    /// Fill the whole area with the background first
+    bool fill;
+    /// Blit the bitmap at all, the fill alone is enough when both colors look the same
+    bool blit;
+    eRasterOp rop;
+};
+
+/// Transparent backgrounds only draw the set bits. Opaque ones copy the bitmap whole when that
+/// gives both colors, or fill the area and punch the ink out of it.
+auto bitmap_ops(eImageColors Color_Foreground, eImageColors Color_Background) -> BitmapOps {
+    // A black color clears pixels, any other color lights them
+    const bool ink = Color_Foreground != eImageColors::BLACK;
+    const bool paper = Color_Background != eImageColors::BLACK;
+    if (Color_Background == eImageColors::FONT_BACKGROUND) {
+        return {false, true, ink ? eRasterOp::ROP_OR : eRasterOp::ROP_AND_NOT};
     }
+    if (ink && !paper) return {false, true, eRasterOp::ROP_COPY};
+    return {true, ink != paper, eRasterOp::ROP_AND_NOT};
 }
 
-auto Paint::draw_char(u16 Xpoint,
-                      u16 Ypoint,
+}  // namespace
+
+auto Paint::draw_char(i32 Xpoint,
+                      i32 Ypoint,
                       const char Acsii_Char,
                       const font::Font &Font,
                       eImageColors Color_Foreground,
+                      eImageColors Color_Background,
+                      u8 Scale) -> void {
+    const u16 index = Font.glyph_index(Acsii_Char);
+    this->draw_glyph(Xpoint,
+                     Ypoint,
+                     Font.table + Font.offsets[index],
+                     Font.Stride,
+                     Font.glyph_columns(index),
+                     Font.Width,
+                     Font.Height,
+                     Font.boxes[index],
+                     Color_Foreground,
+                     Color_Background,
+                     Scale);
+}
+
+#ifdef PICO_OLED_PACKED_FONTS
+auto Paint::draw_char(i32 Xpoint,
+                      i32 Ypoint,
+                      const char Acsii_Char,
+                      const font::PackedFont &Font,
+                      eImageColors Color_Foreground,
+                      eImageColors Color_Background,
+                      u8 Scale) -> void {
+    const u16 index = Font.glyph_index(Acsii_Char);
+    this->draw_glyph(Xpoint,
+                     Ypoint,
+                     this->m_glyph_cache.get(Font, index),
+                     Font.Stride,
+                     nullptr,
+                     Font.Width,
+                     Font.Height,
+                     Font.boxes[index],
+                     Color_Foreground,
+                     Color_Background,
+                     Scale);
+}
+#endif
+
+auto Paint::draw_bits(const u8 *src,
+                      u16 src_stride,
+                      i32 Xstart,
+                      i32 Ystart,
+                      u16 Width,
+                      u16 Height,
+                      u8 Scale,
+                      eImageColors Color_Foreground,
                       eImageColors Color_Background) -> void {
-    if (Xpoint > this->m_width || Ypoint > this->m_height) {
-        Debug("Paint_DrawChar Input exceeds the normal display range\r\n");
+    const bool transparent = Color_Background == eImageColors::FONT_BACKGROUND;
+    for (u16 Page = 0; Page < Height; Page++) {
+        const auto *row = src + Page * src_stride;
+        for (u16 Column = 0; Column < Width; Column++) {
+            const bool set = row[Column / 8] & (0x80 >> (Column % 8));
+            if (!set && transparent) continue;
+            const i32 X = Xstart + Column * Scale;
+            const i32 Y = Ystart + Page * Scale;
+            const auto Color = set ? Color_Foreground : Color_Background;
+            if (Scale == 1) {
+                if (this->m_clip.contains(X, Y)) this->put_pixel(X, Y, Color);
+            } else {
+                this->fill_rect(X, Y, X + Scale - 1, Y + Scale - 1, Color);
+            }
+        }
+    }
+}
+
+auto Paint::draw_glyph(i32 Xpoint,
+                       i32 Ypoint,
+                       const u8 *glyph,
+                       u16 Stride,
+                       const u8 *columns,
+                       u16 Width,
+                       u16 Height,
+                       const font::GlyphBox &box,
+                       eImageColors Color_Foreground,
+                       eImageColors Color_Background,
+                       u8 Scale) -> void {
+    if (Scale == 0 || Scale > k_max_glyph_scale) {
+        Debug("draw_char: scale %u is not within 1 to %u\r\n",
+              static_cast<unsigned>(Scale),
+              static_cast<unsigned>(k_max_glyph_scale));
         return;
     }
 
-    const u32 Char_Offset =
-        (Acsii_Char - ' ') * Font.Height * (Font.Width / 8 + (Font.Width % 8 ? 1 : 0));
-    const auto *ptr = &Font.table[Char_Offset];
-
-    for (u16 Page = 0; Page < Font.Height; Page++) {
-        for (u16 Column = 0; Column < Font.Width; Column++) {
-            // To determine whether the font background color and screen background
-            // color is consistent
-            // this process is to speed up the scan
-            if (eImageColors::FONT_BACKGROUND == Color_Background) {
-                if (*ptr & (0x80 >> (Column % 8)))
-                    this->draw_pixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground,
-                // DOT_PIXEL_DFT, DOT_STYLE_DFT);
-            } else {
-                if (*ptr & (0x80 >> (Column % 8))) {
-                    this->draw_pixel(Xpoint + Column, Ypoint + Page, Color_Foreground);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Foreground,
-                    // DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                } else {
-                    this->draw_pixel(Xpoint + Column, Ypoint + Page, Color_Background);
-                    // Paint_DrawPoint(Xpoint + Column, Ypoint + Page, Color_Background,
-                    // DOT_PIXEL_DFT, DOT_STYLE_DFT);
-                }
-            }
-            // One pixel is 8 bits
-            if (Column % 8 == 7) ptr++;
-        }  // Write a line
-        if (Font.Width % 8 != 0) ptr++;
-    }  // Write all
+    const bool transparent = Color_Background == eImageColors::FONT_BACKGROUND;
+    const i32 Xend = Xpoint + Width * Scale - 1;
+    const i32 Yend = Ypoint + Height * Scale - 1;
+
+    if (box.empty()) {
+        if (!transparent) this->fill_rect(Xpoint, Ypoint, Xend, Yend, Color_Background);
+        return;
+    }
+
+    // Multi-bit scalings keep the exact colors, pixel by pixel
+    if (this->m_scale != eScaling::DOUBLE) {
+        this->draw_bits(glyph,
+                        Stride,
+                        Xpoint,
+                        Ypoint,
+                        Width,
+                        Height,
+                        Scale,
+                        Color_Foreground,
+                        Color_Background);
+        return;
+    }
+
+    // The font rows are 1 bpp bitmaps already, so glyphs are blitted
+    const BitmapOps ops = bitmap_ops(Color_Foreground, Color_Background);
+    const eRasterOp Rop = ops.rop;
+    if (ops.fill) {
+        this->fill_rect(Xpoint, Ypoint, Xend, Yend, Color_Background);
+        if (!ops.blit) return;
+    } else if (Rop == eRasterOp::ROP_COPY) {
+        // Only the rows with ink are copied, the blank rows above and below are filled
+        if (box.top > 0)
+            this->fill_rect(Xpoint, Ypoint, Xend, Ypoint + box.top * Scale - 1, Color_Background);
+        if (Ypoint + (box.bottom + 1) * Scale - 1 < Yend)
+            this->fill_rect(
+                Xpoint, Ypoint + (box.bottom + 1) * Scale, Xend, Yend, Color_Background);
+    }
+
+    const auto ink_height = static_cast<u16>(box.bottom - box.top + 1);
+    const i32 Ytop = Ypoint + box.top * Scale;
+
+    if (Scale > 1) {
+        // Every row is widened through the expansion table and blitted `Scale` times over by
+        // repeating it with a zero stride
+        std::array<u8, k_max_scaled_row> scaled;
+        const auto scaled_width = static_cast<u16>(Width * Scale);
+        for (u16 Page = 0; Page < ink_height; Page++) {
+            expand_glyph_row(glyph + (box.top + Page) * Stride, Width, Scale, scaled.data());
+            this->blit(
+                scaled.data(), 0, Xpoint, Ytop + Page * Scale, scaled_width, Scale, Rop);
+        }
+        return;
+    }
+
+    // Copies replace whole rows, the other operations only need the ink box. Rotated by 90 or
+    // 270 degrees the glyph columns run along buffer rows and are blitted from the transposed
+    // table.
+    const bool whole_rows = Rop == eRasterOp::ROP_COPY;
+    if (columns != nullptr) {
+        const i32 first = whole_rows ? 0 : box.left;
+        const auto column_stride = static_cast<u16>((Height + 7) / 8);
+        if (this->blit_columns(columns + first * column_stride,
+                               column_stride,
+                               box.top,
+                               Xpoint + first,
+                               Ytop,
+                               static_cast<u16>(whole_rows ? Width : box.right - first + 1),
+                               ink_height,
+                               Rop))
+            return;
+    }
+
+    // Otherwise the ink box is cut along rows, its left edge rounded down to a whole byte
+    const i32 ink_left = whole_rows ? 0 : box.left / 8 * 8;
+    const auto ink_width = static_cast<u16>(whole_rows ? Width : box.right - ink_left + 1);
+    this->blit(glyph + box.top * Stride + ink_left / 8,
+               Stride,
+               Xpoint + ink_left,
+               Ytop,
+               ink_width,
+               ink_height,
+               Rop);
 }
 
 auto Paint::draw_en_string(u16 Xstart,
@@ -486,9 +1364,35 @@ auto Paint::draw_en_string(u16 Xstart,
                            const char *pString,
                            const font::Font &Font,
                            eImageColors Color_Foreground,
-                           eImageColors Color_Background) -> void {
+                           eImageColors Color_Background,
+                           u8 Scale) -> void {
+    this->draw_string(Xstart, Ystart, pString, Font, Color_Foreground, Color_Background, Scale);
+}
+
+#ifdef PICO_OLED_PACKED_FONTS
+auto Paint::draw_en_string(u16 Xstart,
+                           u16 Ystart,
+                           const char *pString,
+                           const font::PackedFont &Font,
+                           eImageColors Color_Foreground,
+                           eImageColors Color_Background,
+                           u8 Scale) -> void {
+    this->draw_string(Xstart, Ystart, pString, Font, Color_Foreground, Color_Background, Scale);
+}
+#endif
+
+template <typename FontT>
+auto Paint::draw_string(u16 Xstart,
+                        u16 Ystart,
+                        const char *pString,
+                        const FontT &Font,
+                        eImageColors Color_Foreground,
+                        eImageColors Color_Background,
+                        u8 Scale) -> void {
     u16 Xpoint = Xstart;
     u16 Ypoint = Ystart;
+    const auto Char_Width = static_cast<u16>(Font.Width * Scale);
+    const auto Char_Height = static_cast<u16>(Font.Height * Scale);
 
     if (Xstart > this->m_width || Ystart > this->m_height) {
         Debug("Paint_DrawString_EN Input exceeds the normal display range\r\n");
@@ -498,82 +1402,142 @@ auto Paint::draw_en_string(u16 Xstart,
     while (*pString != '\0') {
         // if X direction filled , reposition to(Xstart,Ypoint),Ypoint is Y
         // direction plus the Height of the character
-        if ((Xpoint + Font.Width) > this->m_width) {
+        if ((Xpoint + Char_Width) > this->m_width) {
             Xpoint = Xstart;
-            Ypoint += Font.Height;
+            Ypoint += Char_Height;
         }
 
         // If the Y direction is full, reposition to(Xstart, Ystart)
-        if ((Ypoint + Font.Height) > this->m_height) {
+        if ((Ypoint + Char_Height) > this->m_height) {
             Xpoint = Xstart;
             Ypoint = Ystart;
         }
 
-        this->draw_char(Xpoint, Ypoint, *pString, Font, Color_Background, Color_Foreground);
+        this->draw_char(
+            Xpoint, Ypoint, *pString, Font, Color_Background, Color_Foreground, Scale);
 
         // The next character of the address
         pString++;
 
         // The next word of the abscissa increases the font of the broadband
-        Xpoint += Font.Width;
+        Xpoint += Char_Width;
     }
 }
 
-auto Paint::draw_number(u16 Xpoint, u16 Ypoint, float Number, const font::Font &Font, u16 precision,
-                        eImageColors Color_Foreground, eImageColors Color_Background) -> void {
-    u16 Num_Bit = 0;
-    u16 Str_Bit = 0;
-    i32 int_part = static_cast<i32>(Number);                  // Integer part of the number
-    float frac_part = Number - static_cast<float>(int_part);  // Fractional part of the number
+auto Paint::draw_text(const Rect &Box,
+                      std::string_view Text,
+                      const font::Font &Font,
+                      eImageColors Color_Foreground,
+                      eImageColors Color_Background,
+                      eTextAlign Align,
+                      u8 Scale) -> std::string_view {
+    return this->layout_text(Box, Text, Font, Color_Foreground, Color_Background, Align, Scale);
+}
 
-    // Hold the final string to be shown on display.
-    std::array<char, std::numeric_limits<char>::max()> string_arr = {0};
-    std::array<u8, std::numeric_limits<u8>::max()> number_arr = {0};
+#ifdef PICO_OLED_PACKED_FONTS
+auto Paint::draw_text(const Rect &Box,
+                      std::string_view Text,
+                      const font::PackedFont &Font,
+                      eImageColors Color_Foreground,
+                      eImageColors Color_Background,
+                      eTextAlign Align,
+                      u8 Scale) -> std::string_view {
+    return this->layout_text(Box, Text, Font, Color_Foreground, Color_Background, Align, Scale);
+}
+#endif
+
+template <typename FontT>
+auto Paint::layout_text(const Rect &Box,
+                        std::string_view Text,
+                        const FontT &Font,
+                        eImageColors Color_Foreground,
+                        eImageColors Color_Background,
+                        eTextAlign Align,
+                        u8 Scale) -> std::string_view {
+    if (Box.empty() || !this->push_clip(Box)) return Text;
+
+    // The box is cleared once, the glyphs then only draw their ink
+    if (Color_Background != eImageColors::FONT_BACKGROUND)
+        this->fill_rect(Box.Xstart, Box.Ystart, Box.Xend, Box.Yend, Color_Background);
+
+    const i32 Advance = Font.Width * Scale;
+    const i32 Line_height = Font.Height * Scale;
+    for (i32 Ypoint = Box.Ystart; !Text.empty() && Ypoint + Line_height - 1 <= Box.Yend;
+         Ypoint += Line_height) {
+        const text::TextLine line = text::next_line(Text, Advance, Box.width());
+
+        i32 Xpoint = Box.Xstart;
+        if (Align == eTextAlign::ALIGN_CENTER)
+            Xpoint += (Box.width() - line.width) / 2;
+        else if (Align == eTextAlign::ALIGN_RIGHT)
+            Xpoint += Box.width() - line.width;
+
+        for (const char c : line.text) {
+            this->draw_char(
+                Xpoint, Ypoint, c, Font, Color_Foreground, eImageColors::FONT_BACKGROUND, Scale);
+            Xpoint += Advance;
+        }
+    }
 
+    this->pop_clip();
+    return Text;
+}
+
+auto Paint::draw_number(u16 Xpoint, u16 Ypoint, float Number, const font::Font &Font, u16 precision,
+                        eImageColors Color_Foreground, eImageColors Color_Background) -> void {
     if (Xpoint > this->m_width || Ypoint > this->m_height) {
         Debug("Paint_DisNum Input exceeds the normal display range\r\n");
         return;
     }
 
-    if (Number < 0) {  // Handle negative numbers
-        string_arr[Str_Bit++] = '-';
-        int_part = -int_part;
-        frac_part = -frac_part;
-    } else if (Number == 0) {  // Zeroes are not handled below, so add it manually
-        string_arr[0] = '0';
-    }
-
-    // Handle digits after the decimal point
-    if (precision > 0) {
-        // shift the fractional parts as many times as necessary
-        for (u8 i = 0; i < precision; i++) {
-            frac_part *= 10;
-        }
-        auto frac_int = static_cast<u32>(frac_part);
+    // The integer part and the truncated fraction are split off once, the digits are integer
+    // math
+    const auto Decimals = static_cast<u8>(std::min<u16>(precision, text::k_max_decimals));
+    const float magnitude = Number < 0 ? -Number : Number;
+    const auto int_part = static_cast<u32>(magnitude);
+    const auto frac_int = static_cast<u32>((magnitude - static_cast<float>(int_part)) *
+                                           static_cast<float>(text::k_powers_of_ten[Decimals]));
 
-        // Converts the fractional part to a string
-        for (u8 i = 0; i < precision; i++) {
-            number_arr[Num_Bit++] = frac_int % 10 + '0';
-            frac_int /= 10;
-        }
+    const auto number = text::format_number(Number < 0, int_part, frac_int, Decimals);
+    this->draw_en_string(Xpoint, Ypoint, number.c_str(), Font, Color_Background,
+                         Color_Foreground);
+}
 
-        number_arr[Num_Bit++] = '.';
-    }
+auto Paint::draw_int(i32 Xpoint,
+                     i32 Ypoint,
+                     i32 Value,
+                     const font::Font &Font,
+                     eImageColors Color_Foreground,
+                     eImageColors Color_Background,
+                     u8 Width,
+                     char Pad) -> void {
+    const auto number = text::format_int(Value, Width, Pad);
+    this->draw_run(Xpoint, Ypoint, number.view(), Font, Color_Foreground, Color_Background);
+}
 
-    // Converts the integer part to a string
-    while (int_part) {
-        number_arr[Num_Bit++] = static_cast<u32>(int_part) % 10 + '0';
-        int_part /= 10;
-    }
+auto Paint::draw_fixed(i32 Xpoint,
+                       i32 Ypoint,
+                       i32 Value,
+                       u8 Decimals,
+                       const font::Font &Font,
+                       eImageColors Color_Foreground,
+                       eImageColors Color_Background,
+                       u8 Width,
+                       char Pad) -> void {
+    const auto number = text::format_fixed(Value, Decimals, Width, Pad);
+    this->draw_run(Xpoint, Ypoint, number.view(), Font, Color_Foreground, Color_Background);
+}
 
-    // Invert the string (both integer and fractional parts)
-    while (Num_Bit > 0) {
-        string_arr[Str_Bit++] = number_arr[--Num_Bit];
+auto Paint::draw_run(i32 Xpoint,
+                     i32 Ypoint,
+                     std::string_view Text,
+                     const font::Font &Font,
+                     eImageColors Color_Foreground,
+                     eImageColors Color_Background) -> void {
+    for (const char c : Text) {
+        this->draw_char(Xpoint, Ypoint, c, Font, Color_Foreground, Color_Background);
+        Xpoint += Font.Width;
     }
-
-    // Display the string
-    this->draw_en_string(Xpoint, Ypoint, string_arr.data(), Font, Color_Background,
-                         Color_Foreground);
 }
 
 auto Paint::draw_time(u16 Xstart,
@@ -613,17 +1577,43 @@ auto Paint::draw_time(u16 Xstart,
 }
 
 auto Paint::draw_image(const u8 *image, u16 xStart, u16 yStart, u16 W_Image, u16 H_Image) -> void {
+    // Source pixels are 16 bit colors, low byte first. Multi-bit scalings keep them, pixel by
+    // pixel.
+    if (this->m_scale != eScaling::DOUBLE) {
+        for (i32 j = 0; j < H_Image; j++) {
+            const u8 *row = image + j * W_Image * 2;
+            for (i32 i = 0; i < W_Image; i++) {
+                if (!this->m_clip.contains(xStart + i, yStart + j)) continue;
+                const auto col = static_cast<eImageColors>(row[i * 2 + 1] << 8 | row[i * 2]);
+                this->put_pixel(xStart + i, yStart + j, col);
+            }
+        }
+        return;
+    }
+
+    // 1 bpp packs every row into bits a chunk at a time, any color but black lights the pixel
+    std::array<u8, 8> bits;
+    constexpr i32 chunk = bits.size() * 8;
+
     for (i32 j = 0; j < H_Image; j++) {
-        for (i32 i = 0; i < W_Image; i++) {
-            if (xStart + i < this->m_width_memory &&
-                yStart + j < this->m_height_memory) {  // Exceeded part does not display
-                auto col = static_cast<eImageColors>((*(image + j * W_Image * 2 + i * 2 + 1)) << 8 |
-                                                     (*(image + j * W_Image * 2 + i * 2)));
-                this->draw_pixel(xStart + i, yStart + j, col);
-                // Using arrays is a property of sequential storage, accessing the
-                // original array by
-                // algorithm j*W_Image*2 			   Y offset i*2 X offset
+        const i32 Ypoint = yStart + j;
+        if (Ypoint < this->m_clip.Ystart || Ypoint > this->m_clip.Yend) continue;
+
+        const u8 *row = image + j * W_Image * 2;
+        for (i32 i = 0; i < W_Image; i += chunk) {
+            const i32 count = std::min<i32>(chunk, W_Image - i);
+            bits.fill(0);
+            for (i32 k = 0; k < count; k++) {
+                if (row[(i + k) * 2] | row[(i + k) * 2 + 1])
+                    bits[static_cast<u32>(k / 8)] |= static_cast<u8>(0x80u >> (k % 8));
             }
+            this->blit(bits.data(),
+                       bits.size(),
+                       xStart + i,
+                       Ypoint,
+                       static_cast<u16>(count),
+                       1,
+                       eRasterOp::ROP_COPY);
         }
     }
 }
@@ -647,15 +1637,288 @@ auto Paint::draw_bitmap_block(const u8 *image_buffer, u8 Region) -> void {
     }
 }
 
-auto Paint::bmp_windows(const u8 x, const u8 y, const u8 *pBmp, const u8 chWidth, const u8 chHeight)
-    -> void {
-    const u16 byteWidth = (chWidth + 7) / 8;
+namespace {
+
+/// Combines the `bits` selected by `mask` into `dst`
+template <eRasterOp Rop>
+constexpr auto combine(u8 dst, u8 bits, u8 mask) -> u8 {
+    if constexpr (Rop == eRasterOp::ROP_COPY) {
+        return static_cast<u8>((dst & ~mask) | (bits & mask));
+    } else if constexpr (Rop == eRasterOp::ROP_OR) {
+        return static_cast<u8>(dst | (bits & mask));
+    } else if constexpr (Rop == eRasterOp::ROP_AND) {
+        return static_cast<u8>(dst & (bits | ~mask));
+    } else if constexpr (Rop == eRasterOp::ROP_AND_NOT) {
+        return static_cast<u8>(dst & ~(bits & mask));
+    } else {
+        return static_cast<u8>(dst ^ (bits & mask));
+    }
+}
+
+/// A blit already trimmed to the clip, with every source row landing on consecutive bits of
+/// one buffer row
+struct BlitRows {
+    u8 *dst;         // buffer row of the first source row
+    i32 dst_step;    // bytes between buffer rows, negative when the rows are flipped
+    i32 dst_x;       // buffer column of the first pixel
+    const u8 *src;   // first visible source row
+    i32 src_stride;  // bytes between source rows
+    i32 src_x;       // source column of the first pixel
+    i32 width;
+    i32 height;
+};
+
+template <eRasterOp Rop>
+auto blit_rows(const BlitRows &blit) -> void {
+    const i32 first = blit.dst_x / 8;
+    const i32 last = (blit.dst_x + blit.width - 1) / 8;
+    const auto left_mask = static_cast<u8>(0xFFu >> (blit.dst_x % 8));
+    const auto right_mask = static_cast<u8>(0xFFu << (7 - (blit.dst_x + blit.width - 1) % 8));
+
+    // Source bytes holding visible pixels, nothing outside them is read
+    const i32 src_first = blit.src_x / 8;
+    const i32 src_last = (blit.src_x + blit.width - 1) / 8;
+    // Source bit landing on the MSB of buffer byte `first`, negative if that bit is masked off
+    const i32 src_bit = blit.src_x - blit.dst_x % 8;
+
+    u8 *dst_row = blit.dst;
+    const u8 *src_row = blit.src;
+    for (i32 row = 0; row < blit.height; row++) {
+        i32 bit = src_bit;
+        for (i32 X = first; X <= last; X++, bit += 8) {
+            // Funnel shift of the two source bytes straddling `bit`
+            const i32 index = bit >> 3;
+            const u32 high = index >= src_first ? src_row[index] : 0u;
+            const u32 low = index < src_last ? src_row[index + 1] : 0u;
+            const auto bits = static_cast<u8>(((high << 8 | low) << (bit & 7)) >> 8);
+
+            u8 mask = 0xFF;
+            if (X == first) mask &= left_mask;
+            if (X == last) mask &= right_mask;
+            dst_row[X] = combine<Rop>(dst_row[X], bits, mask);
+        }
+        dst_row += blit.dst_step;
+        src_row += blit.src_stride;
+    }
+}
+
+}  // namespace
+
+auto Paint::blit(const u8 *src,
+                 u16 src_stride,
+                 i32 Xstart,
+                 i32 Ystart,
+                 u16 Width,
+                 u16 Height,
+                 eRasterOp Rop) -> void {
+    // Visible part of the bitmap in logical coordinates
+    const i32 X0 = std::max<i32>(Xstart, this->m_clip.Xstart);
+    const i32 Y0 = std::max<i32>(Ystart, this->m_clip.Ystart);
+    const i32 X1 = std::min<i32>(Xstart + Width - 1, this->m_clip.Xend);
+    const i32 Y1 = std::min<i32>(Ystart + Height - 1, this->m_clip.Yend);
+    if (X0 > X1 || Y0 > Y1) return;
+
+    const i32 src_x = X0 - Xstart;
+    const u8 *src_row = src + (Y0 - Ystart) * src_stride;
+
+    // Buffer position of the first visible pixel and of its right and lower neighbours
+    i32 mem_x, mem_y, right_x, right_y, below_x, below_y;
+    this->to_memory(X0, Y0, mem_x, mem_y);
+    this->to_memory(X0 + 1, Y0, right_x, right_y);
+    this->to_memory(X0, Y0 + 1, below_x, below_y);
+
+    if (this->m_scale == eScaling::DOUBLE && right_x == mem_x + 1 && right_y == mem_y) {
+        const BlitRows rows = {&this->m_image_buf[static_cast<u32>(mem_y * this->m_width_byte)],
+                               (below_y - mem_y) * this->m_width_byte,
+                               mem_x,
+                               src_row,
+                               src_stride,
+                               src_x,
+                               X1 - X0 + 1,
+                               Y1 - Y0 + 1};
+        switch (Rop) {
+            case eRasterOp::ROP_COPY:
+                blit_rows<eRasterOp::ROP_COPY>(rows);
+                break;
+            case eRasterOp::ROP_OR:
+                blit_rows<eRasterOp::ROP_OR>(rows);
+                break;
+            case eRasterOp::ROP_AND:
+                blit_rows<eRasterOp::ROP_AND>(rows);
+                break;
+            case eRasterOp::ROP_AND_NOT:
+                blit_rows<eRasterOp::ROP_AND_NOT>(rows);
+                break;
+            case eRasterOp::ROP_XOR:
+                blit_rows<eRasterOp::ROP_XOR>(rows);
+                break;
+        }
+        return;
+    }
 
-    for (u16 j = 0; j < chHeight; j++) {
-        for (u16 i = 0; i < chWidth; i++) {
-            if (*(pBmp + j * byteWidth + i / 8) & (128 >> (i & 7))) {
-                this->draw_pixel(x + i, y + j, eImageColors::WHITE);
+    // Columns of the bitmap run along buffer columns, combine pixel by pixel
+    for (i32 Y = Y0; Y <= Y1; Y++, src_row += src_stride) {
+        for (i32 X = X0; X <= X1; X++) {
+            const i32 column = src_x + X - X0;
+            const bool bit = src_row[column / 8] & (0x80 >> (column % 8));
+
+            switch (Rop) {
+                case eRasterOp::ROP_COPY:
+                    this->put_pixel(X, Y, bit ? eImageColors::WHITE : eImageColors::BLACK);
+                    break;
+                case eRasterOp::ROP_OR:
+                    if (bit) this->put_pixel(X, Y, eImageColors::WHITE);
+                    break;
+                case eRasterOp::ROP_AND:
+                    if (!bit) this->put_pixel(X, Y, eImageColors::BLACK);
+                    break;
+                case eRasterOp::ROP_AND_NOT:
+                    if (bit) this->put_pixel(X, Y, eImageColors::BLACK);
+                    break;
+                case eRasterOp::ROP_XOR:
+                    if (bit) this->invert_pixel(X, Y);
+                    break;
             }
         }
     }
 }
+
+namespace {
+
+/// A column blit already trimmed to the clip, with every source column landing on
+/// consecutive bits of one buffer row
+struct BlitColumns {
+    u8 *dst;         // buffer row of the first source column
+    i32 dst_step;    // bytes between buffer rows, negative when the columns are flipped
+    i32 dst_x;       // buffer column of the leftmost pixel
+    const u8 *src;   // first visible source column
+    i32 src_stride;  // bytes per source column, at most four
+    i32 shift;       // moves the bit of the leftmost pixel to the MSB
+    bool reversed;   // the column runs right to left through the buffer
+    i32 width;       // visible pixels per column
+    i32 columns;
+};
+
+template <eRasterOp Rop>
+auto blit_columns_rows(const BlitColumns &blit) -> void {
+    // The visible bits of a column fit a word, shifted to their bit offset they span five
+    // buffer bytes at most
+    const u32 visible = blit.width == 32 ? ~0u : ~(~0u >> blit.width);
+    const u64 mask = (static_cast<u64>(visible) << 32) >> (blit.dst_x % 8);
+    const i32 bytes = (blit.dst_x % 8 + blit.width + 7) / 8;
+
+    u8 *dst_row = blit.dst + blit.dst_x / 8;
+    const u8 *src_column = blit.src;
+    for (i32 column = 0; column < blit.columns; column++) {
+        u32 word = 0;
+        for (i32 i = 0; i < blit.src_stride; i++) {
+            word |= static_cast<u32>(src_column[i]) << (24 - 8 * i);
+        }
+        if (blit.reversed) word = pico_oled::buffer::reverse_bits(word);
+        const u64 bits = (static_cast<u64>(word << blit.shift) << 32) >> (blit.dst_x % 8);
+
+        for (i32 i = 0; i < bytes; i++) {
+            dst_row[i] = combine<Rop>(dst_row[i],
+                                      static_cast<u8>(bits >> (56 - 8 * i)),
+                                      static_cast<u8>(mask >> (56 - 8 * i)));
+        }
+        dst_row += blit.dst_step;
+        src_column += blit.src_stride;
+    }
+}
+
+}  // namespace
+
+auto Paint::blit_columns(const u8 *src,
+                         u16 src_stride,
+                         u16 src_y,
+                         i32 Xstart,
+                         i32 Ystart,
+                         u16 Width,
+                         u16 Height,
+                         eRasterOp Rop) -> bool {
+    if (this->m_scale != eScaling::DOUBLE || src_stride > 4) return false;
+
+    // Visible part of the bitmap in logical coordinates
+    const i32 X0 = std::max<i32>(Xstart, this->m_clip.Xstart);
+    const i32 Y0 = std::max<i32>(Ystart, this->m_clip.Ystart);
+    const i32 X1 = std::min<i32>(Xstart + Width - 1, this->m_clip.Xend);
+    const i32 Y1 = std::min<i32>(Ystart + Height - 1, this->m_clip.Yend);
+    if (X0 > X1 || Y0 > Y1) return true;
+
+    // Buffer position of the first visible pixel and of its right and lower neighbours, the
+    // logical columns have to run along buffer rows
+    i32 mem_x, mem_y, right_x, right_y, below_x, below_y;
+    this->to_memory(X0, Y0, mem_x, mem_y);
+    this->to_memory(X0 + 1, Y0, right_x, right_y);
+    this->to_memory(X0, Y0 + 1, below_x, below_y);
+    if (right_x != mem_x || below_y != mem_y) return false;
+
+    // Source bit of the leftmost pixel in the buffer, of the bottom visible row when reversed
+    const bool reversed = below_x < mem_x;
+    const i32 first_bit = src_y + (reversed ? Y1 : Y0) - Ystart;
+    const BlitColumns columns = {&this->m_image_buf[static_cast<u32>(mem_y * this->m_width_byte)],
+                                 (right_y - mem_y) * this->m_width_byte,
+                                 reversed ? mem_x - (Y1 - Y0) : mem_x,
+                                 src + (X0 - Xstart) * src_stride,
+                                 src_stride,
+                                 reversed ? 31 - first_bit : first_bit,
+                                 reversed,
+                                 Y1 - Y0 + 1,
+                                 X1 - X0 + 1};
+    switch (Rop) {
+        case eRasterOp::ROP_COPY:
+            blit_columns_rows<eRasterOp::ROP_COPY>(columns);
+            break;
+        case eRasterOp::ROP_OR:
+            blit_columns_rows<eRasterOp::ROP_OR>(columns);
+            break;
+        case eRasterOp::ROP_AND:
+            blit_columns_rows<eRasterOp::ROP_AND>(columns);
+            break;
+        case eRasterOp::ROP_AND_NOT:
+            blit_columns_rows<eRasterOp::ROP_AND_NOT>(columns);
+            break;
+        case eRasterOp::ROP_XOR:
+            blit_columns_rows<eRasterOp::ROP_XOR>(columns);
+            break;
+    }
+    return true;
+}
+
+auto Paint::draw_mask(const u8 *src,
+                      u16 src_stride,
+                      i32 Xstart,
+                      i32 Ystart,
+                      u16 Width,
+                      u16 Height,
+                      eImageColors Color_Foreground,
+                      eImageColors Color_Background) -> void {
+    if (Width == 0 || Height == 0) return;
+
+    // Blits only write lit or dark pixels, multi-bit scalings keep the exact colors
+    if (this->m_scale != eScaling::DOUBLE) {
+        this->draw_bits(
+            src, src_stride, Xstart, Ystart, Width, Height, 1, Color_Foreground, Color_Background);
+        return;
+    }
+
+    // Same choice of operations as for glyphs
+    const BitmapOps ops = bitmap_ops(Color_Foreground, Color_Background);
+    if (ops.fill) {
+        this->fill_rect(
+            Xstart, Ystart, Xstart + Width - 1, Ystart + Height - 1, Color_Background);
+    }
+    if (ops.blit) this->blit(src, src_stride, Xstart, Ystart, Width, Height, ops.rop);
+}
+
+auto Paint::bmp_windows(const u8 x, const u8 y, const u8 *pBmp, const u8 chWidth, const u8 chHeight)
+    -> void {
+    this->blit(pBmp,
+               static_cast<u16>((chWidth + 7) / 8),
+               x,
+               y,
+               chWidth,
+               chHeight,
+               eRasterOp::ROP_OR);
+}
@@ -0,0 +1,139 @@
+#include "signal_plot.hpp"
+
+#include <algorithm>
+#include <limits>
+
+#include "dirty_rects.hpp"
+#include "paint.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+using namespace pico_oled::paint;
+using pico_oled::DirtyRects;
+using pico_oled::Rect;
+
+namespace {
+
+/// Range of a column before its first sample, any sample narrows it
+constexpr i32 k_no_low = std::numeric_limits<i32>::max();
+constexpr i32 k_no_high = std::numeric_limits<i32>::min();
+
+}  // namespace
+
+SignalPlot::SignalPlot(const Rect &Area,
+                       i32 Min,
+                       i32 Max,
+                       u16 Samples_per_column,
+                       eImageColors Color_Foreground,
+                       eImageColors Color_Background)
+    : m_area(Area.intersect({Area.Xstart,
+                             Area.Ystart,
+                             static_cast<i16>(Area.Xstart + k_plot_columns - 1),
+                             static_cast<i16>(Area.Ystart + 255)})),
+      m_min(std::min(Min, Max)),
+      m_max(std::max(Min, Max)),
+      m_samples_per_column(std::max<u16>(Samples_per_column, 1)),
+      m_foreground(Color_Foreground),
+      m_background(Color_Background),
+      m_columns(),
+      m_head(0),
+      m_count(0),
+      m_pending(0),
+      m_low(k_no_low),
+      m_high(k_no_high),
+      m_taken(0),
+      m_valid(false) {}
+
+auto SignalPlot::row(i32 Value) const -> u8 {
+    const i32 height = this->m_area.height();
+    if (height <= 1 || this->m_max == this->m_min) {
+        return static_cast<u8>(std::max<i32>(height - 1, 0));
+    }
+
+    const i32 value = std::clamp(Value, this->m_min, this->m_max);
+    // In 64 bits, the range of two i32 times the height does not fit 32
+    const i64 above = static_cast<i64>(this->m_max) - value;
+    const i64 range = static_cast<i64>(this->m_max) - this->m_min;
+    return static_cast<u8>((above * (height - 1) + range / 2) / range);
+}
+
+auto SignalPlot::push_column() -> void {
+    // Larger values are higher up, so the top row comes from the maximum
+    this->m_columns[this->m_head] = {this->row(this->m_high), this->row(this->m_low)};
+    this->m_head = static_cast<u16>((this->m_head + 1) % k_plot_columns);
+    this->m_count = std::min<u16>(static_cast<u16>(this->m_count + 1), k_plot_columns);
+    this->m_pending = std::min<u16>(static_cast<u16>(this->m_pending + 1), k_plot_columns);
+
+    this->m_low = k_no_low;
+    this->m_high = k_no_high;
+    this->m_taken = 0;
+}
+
+auto SignalPlot::add(std::span<const u16> Samples) -> void {
+    for (const u16 sample : Samples) this->add(static_cast<i32>(sample));
+}
+
+auto SignalPlot::column(u16 Age) const -> Column {
+    return this->m_columns[(this->m_head + k_plot_columns - 1 - Age) % k_plot_columns];
+}
+
+auto SignalPlot::draw_column(Paint &paint, u16 Age, i32 Xpoint) const -> void {
+    Column span = this->column(Age);
+    if (Age + 1 < this->m_count) {
+        // Reach the column before, so that a jump between them is drawn as a line
+        const Column before = this->column(static_cast<u16>(Age + 1));
+        if (span.top > before.bottom) span.top = static_cast<u8>(before.bottom + 1);
+        if (span.bottom < before.top) span.bottom = static_cast<u8>(before.top - 1);
+    }
+    paint.ClearWindows(Xpoint,
+                       this->m_area.Ystart,
+                       Xpoint + 1,
+                       this->m_area.Yend + 1,
+                       this->m_background);
+    paint.ClearWindows(Xpoint,
+                       this->m_area.Ystart + span.top,
+                       Xpoint + 1,
+                       this->m_area.Ystart + span.bottom + 1,
+                       this->m_foreground);
+}
+
+auto SignalPlot::draw(Paint &paint, DirtyRects &Dirty) -> bool {
+    const i32 width = this->m_area.width();
+    if (width == 0) return false;
+    if (this->m_valid && this->m_pending == 0) return false;
+
+    // New columns come in at the right edge, the newest one on it
+    const i32 right = this->m_area.Xend;
+    u16 fresh = this->m_pending;
+    if (!this->m_valid || fresh >= width) {
+        paint.ClearWindows(this->m_area.Xstart,
+                           this->m_area.Ystart,
+                           this->m_area.Xend + 1,
+                           this->m_area.Yend + 1,
+                           this->m_background);
+        fresh = static_cast<u16>(std::min<i32>(this->m_count, width));
+    } else {
+        paint.scroll_region(this->m_area, -fresh, 0, this->m_background);
+    }
+
+    for (u16 age = 0; age < fresh; age++) this->draw_column(paint, age, right - age);
+
+    Dirty.add(this->m_area);
+    this->m_pending = 0;
+    this->m_valid = true;
+    return true;
+}
+
+auto SignalPlot::clear() -> void {
+    this->m_head = 0;
+    this->m_count = 0;
+    this->m_pending = 0;
+    this->m_low = k_no_low;
+    this->m_high = k_no_high;
+    this->m_taken = 0;
+    this->m_valid = false;
+}
+
+auto SignalPlot::invalidate() -> void { this->m_valid = false; }
+
+auto SignalPlot::bounds() const -> Rect { return this->m_area; }
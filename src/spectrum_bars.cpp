@@ -0,0 +1,157 @@
+#include "spectrum_bars.hpp"
+
+#include <algorithm>
+#include <bit>
+
+#include "dirty_rects.hpp"
+#include "fft_q15.hpp"
+#include "paint.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+using namespace pico_oled::paint;
+using namespace pico_oled::dsp;
+using pico_oled::DirtyRects;
+using pico_oled::Rect;
+
+SpectrumBars::SpectrumBars(const Rect &Area,
+                           u8 Bars,
+                           u16 Points,
+                           eImageColors Color_Foreground,
+                           eImageColors Color_Background)
+    : m_area(Area.intersect(
+          {Area.Xstart, Area.Ystart, Area.Xend, static_cast<i16>(Area.Ystart + 254)})),
+      m_points(std::bit_floor(std::clamp<u16>(Points, 4, k_fft_max_points))),
+      m_bars(0),
+      m_foreground(Color_Foreground),
+      m_background(Color_Background),
+      m_edges(),
+      m_real(),
+      m_imag(),
+      m_magnitudes(),
+      m_shown(),
+      m_drawn(),
+      m_hold(),
+      m_valid(false) {
+    // Bin 0 is the DC offset of the samples, the bars start at bin 1
+    const u16 bins = static_cast<u16>(this->m_points / 2);
+    this->m_bars = static_cast<u8>(std::clamp<u16>(Bars, 1, std::min<u16>(k_spectrum_bars,
+                                                                           bins - 1)));
+
+    // Bar i starts where log2 of the bin reaches i / bars of log2 of the last bin, at least a
+    // bin after the bar before and leaving a bin for each bar after it
+    const u32 span = log2_q8(bins);
+    this->m_edges[0] = 1;
+    for (u8 i = 1; i <= this->m_bars; i++) {
+        const u32 target = span * i / this->m_bars;
+        const u16 last = static_cast<u16>(bins - (this->m_bars - i));
+        u16 edge = static_cast<u16>(this->m_edges[i - 1] + 1);
+        while (edge < last && log2_q8(edge) < target) edge++;
+        this->m_edges[i] = static_cast<u8>(std::min(edge, last));
+    }
+}
+
+auto SpectrumBars::level(u16 Magnitude) const -> u8 {
+    const i32 log = log2_q8(Magnitude);
+    if (log <= k_spectrum_floor) return 0;
+    if (log >= k_spectrum_ceiling) return static_cast<u8>(this->m_area.height());
+    return static_cast<u8>((log - k_spectrum_floor) * this->m_area.height() /
+                           (k_spectrum_ceiling - k_spectrum_floor));
+}
+
+auto SpectrumBars::update(std::span<const i16> Samples) -> void {
+    const std::size_t taken = std::min<std::size_t>(Samples.size(), this->m_points);
+    std::copy_n(Samples.begin(), taken, this->m_real.begin());
+    std::fill(this->m_real.begin() + taken, this->m_real.begin() + this->m_points, 0);
+    std::fill_n(this->m_imag.begin(), this->m_points, 0);
+
+    const std::span<i16> real(this->m_real.data(), this->m_points);
+    const std::span<i16> imag(this->m_imag.data(), this->m_points);
+    apply_hann(real);
+    fft(real, imag);
+    magnitudes(real, imag, std::span(this->m_magnitudes.data(), this->m_points / 2));
+
+    for (u8 i = 0; i < this->m_bars; i++) {
+        const auto first = this->m_magnitudes.begin() + this->m_edges[i];
+        const auto last = this->m_magnitudes.begin() + this->m_edges[i + 1];
+        Bar &bar = this->m_shown[i];
+        bar.level = this->level(*std::max_element(first, last));
+
+        if (bar.level >= bar.peak) {
+            bar.peak = bar.level;
+            this->m_hold[i] = k_peak_hold_frames;
+        } else if (this->m_hold[i] > 0) {
+            this->m_hold[i]--;
+        } else {
+            bar.peak--;
+        }
+    }
+}
+
+auto SpectrumBars::draw_bar(Paint &paint, u8 Index, bool Whole, DirtyRects &Dirty) -> bool {
+    const Bar &shown = this->m_shown[Index];
+    const Bar &drawn = this->m_drawn[Index];
+    if (!Whole && shown.level == drawn.level && shown.peak == drawn.peak) return false;
+
+    // Heights from the bottom of the area, a bar lights [0, level) and its marker peak - 1
+    i32 low = 0;
+    i32 high = this->m_area.height();
+    if (!Whole) {
+        const i32 shown_marker = std::max<i32>(shown.peak - 1, 0);
+        const i32 drawn_marker = std::max<i32>(drawn.peak - 1, 0);
+        low = std::min({i32{shown.level}, i32{drawn.level}, shown_marker, drawn_marker});
+        high = std::max({i32{shown.level}, i32{drawn.level}, i32{shown.peak}, i32{drawn.peak}});
+    }
+
+    const i32 pitch = this->m_area.width() / this->m_bars;
+    const i32 left = this->m_area.Xstart + Index * pitch;
+    const i32 right = left + std::max<i32>(pitch - 1, 1);
+    const i32 bottom = this->m_area.Yend + 1;
+
+    paint.ClearWindows(left, bottom - high, right, bottom - low, this->m_background);
+    if (shown.level > low) {
+        paint.ClearWindows(left,
+                           bottom - std::min<i32>(shown.level, high),
+                           right,
+                           bottom - low,
+                           this->m_foreground);
+    }
+    if (shown.peak > shown.level && shown.peak - 1 >= low && shown.peak <= high) {
+        paint.ClearWindows(left,
+                           bottom - shown.peak,
+                           right,
+                           bottom - shown.peak + 1,
+                           this->m_foreground);
+    }
+
+    Dirty.add({static_cast<i16>(left),
+               static_cast<i16>(bottom - high),
+               static_cast<i16>(right - 1),
+               static_cast<i16>(bottom - low - 1)});
+    this->m_drawn[Index] = shown;
+    return true;
+}
+
+auto SpectrumBars::draw(Paint &paint, DirtyRects &Dirty) -> bool {
+    if (this->m_area.empty() || this->m_area.width() < this->m_bars) return false;
+
+    const bool whole = !this->m_valid;
+    if (whole) {
+        paint.ClearWindows(this->m_area.Xstart,
+                           this->m_area.Ystart,
+                           this->m_area.Xend + 1,
+                           this->m_area.Yend + 1,
+                           this->m_background);
+        Dirty.add(this->m_area);
+    }
+
+    bool drawn = false;
+    for (u8 i = 0; i < this->m_bars; i++) drawn = this->draw_bar(paint, i, whole, Dirty) || drawn;
+
+    this->m_valid = true;
+    return drawn;
+}
+
+auto SpectrumBars::invalidate() -> void { this->m_valid = false; }
+
+auto SpectrumBars::bounds() const -> Rect { return this->m_area; }
@@ -0,0 +1,291 @@
+#include "widget_tree.hpp"
+
+#include <algorithm>
+
+#include "dirty_rects.hpp"
+#include "number_format.hpp"
+#include "paint.hpp"
+#include "rect.hpp"
+#include "types.hpp"
+
+using namespace pico_oled::paint;
+using pico_oled::DirtyRects;
+using pico_oled::Rect;
+
+namespace {
+
+constexpr Rect k_nowhere = {0, 0, -1, -1};
+
+/// Draws the one pixel border of `Area`
+auto outline(Paint &paint, const Rect &Area, eImageColors Color) -> void {
+    paint.ClearWindows(Area.Xstart, Area.Ystart, Area.Xend + 1, Area.Ystart + 1, Color);
+    paint.ClearWindows(Area.Xstart, Area.Yend, Area.Xend + 1, Area.Yend + 1, Color);
+    paint.ClearWindows(Area.Xstart, Area.Ystart, Area.Xstart + 1, Area.Yend + 1, Color);
+    paint.ClearWindows(Area.Xend, Area.Ystart, Area.Xend + 1, Area.Yend + 1, Color);
+}
+
+}  // namespace
+
+WidgetTree::WidgetTree(eImageColors Color_Background)
+    : m_widgets(), m_count(0), m_background(Color_Background), m_whole(false) {}
+
+auto WidgetTree::add(const Widget &widget) -> WidgetId {
+    if (this->m_count == k_max_widgets) return k_no_widget;
+    if (widget.parent != k_no_widget && !this->valid(widget.parent)) return k_no_widget;
+
+    Widget &added = this->m_widgets[this->m_count];
+    added = widget;
+    added.visible = true;
+    added.changed = true;
+    added.drawn = k_nowhere;
+    return this->m_count++;
+}
+
+auto WidgetTree::add_label(WidgetId Parent,
+                           const Rect &Box,
+                           std::string_view Text,
+                           const font::Font &Font,
+                           eImageColors Color_Foreground,
+                           eImageColors Color_Background,
+                           eTextAlign Align) -> WidgetId {
+    Widget widget = {};
+    widget.kind = eWidgetKind::LABEL;
+    widget.parent = Parent;
+    widget.foreground = Color_Foreground;
+    widget.background = Color_Background;
+    widget.box = Box;
+    widget.font = &Font;
+    widget.text = Text;
+    widget.align = Align;
+    return this->add(widget);
+}
+
+auto WidgetTree::add_number(WidgetId Parent,
+                            const Rect &Box,
+                            i32 Value,
+                            const font::Font &Font,
+                            eImageColors Color_Foreground,
+                            eImageColors Color_Background,
+                            u8 Decimals) -> WidgetId {
+    Widget widget = {};
+    widget.kind = eWidgetKind::NUMBER;
+    widget.parent = Parent;
+    widget.foreground = Color_Foreground;
+    widget.background = Color_Background;
+    widget.box = Box;
+    widget.font = &Font;
+    widget.value = Value;
+    widget.decimals = std::min(Decimals, text::k_max_decimals);
+    return this->add(widget);
+}
+
+auto WidgetTree::add_bar(WidgetId Parent,
+                         const Rect &Box,
+                         i32 Value,
+                         i32 Min,
+                         i32 Max,
+                         eImageColors Color_Foreground,
+                         eImageColors Color_Background) -> WidgetId {
+    Widget widget = {};
+    widget.kind = eWidgetKind::BAR;
+    widget.parent = Parent;
+    widget.foreground = Color_Foreground;
+    widget.background = Color_Background;
+    widget.box = Box;
+    widget.value = Value;
+    widget.min = std::min(Min, Max);
+    widget.max = std::max(Min, Max);
+    return this->add(widget);
+}
+
+auto WidgetTree::add_icon(WidgetId Parent,
+                          i32 Xstart,
+                          i32 Ystart,
+                          const u8 *src,
+                          u16 src_stride,
+                          u16 Width,
+                          u16 Height,
+                          eImageColors Color_Foreground,
+                          eImageColors Color_Background) -> WidgetId {
+    Widget widget = {};
+    widget.kind = eWidgetKind::ICON;
+    widget.parent = Parent;
+    widget.foreground = Color_Foreground;
+    widget.background = Color_Background;
+    widget.box = {static_cast<i16>(Xstart),
+                  static_cast<i16>(Ystart),
+                  static_cast<i16>(Xstart + Width - 1),
+                  static_cast<i16>(Ystart + Height - 1)};
+    widget.src = src;
+    widget.src_stride = src_stride;
+    return this->add(widget);
+}
+
+auto WidgetTree::add_rectangle(WidgetId Parent, const Rect &Box, eImageColors Color, bool Filled)
+    -> WidgetId {
+    Widget widget = {};
+    widget.kind = eWidgetKind::RECTANGLE;
+    widget.parent = Parent;
+    widget.foreground = Color;
+    widget.background = Color;
+    widget.box = Box;
+    widget.filled = Filled;
+    return this->add(widget);
+}
+
+auto WidgetTree::set_text(WidgetId Id, std::string_view Text) -> void {
+    if (!this->valid(Id) || this->m_widgets[Id].text == Text) return;
+    this->m_widgets[Id].text = Text;
+    this->m_widgets[Id].changed = true;
+}
+
+auto WidgetTree::set_value(WidgetId Id, i32 Value) -> void {
+    if (!this->valid(Id) || this->m_widgets[Id].value == Value) return;
+    this->m_widgets[Id].value = Value;
+    this->m_widgets[Id].changed = true;
+}
+
+auto WidgetTree::set_visible(WidgetId Id, bool Visible) -> void {
+    // The areas shown before and after are compared in `render`, nothing to note here
+    if (this->valid(Id)) this->m_widgets[Id].visible = Visible;
+}
+
+auto WidgetTree::move_to(WidgetId Id, i32 Xstart, i32 Ystart) -> void {
+    if (!this->valid(Id)) return;
+    Rect &box = this->m_widgets[Id].box;
+    box = {static_cast<i16>(Xstart),
+           static_cast<i16>(Ystart),
+           static_cast<i16>(Xstart + box.Xend - box.Xstart),
+           static_cast<i16>(Ystart + box.Yend - box.Ystart)};
+}
+
+auto WidgetTree::set_colors(WidgetId Id,
+                            eImageColors Color_Foreground,
+                            eImageColors Color_Background) -> void {
+    if (!this->valid(Id)) return;
+    Widget &widget = this->m_widgets[Id];
+    if (widget.foreground == Color_Foreground && widget.background == Color_Background) return;
+    widget.foreground = Color_Foreground;
+    widget.background = Color_Background;
+    widget.changed = true;
+}
+
+auto WidgetTree::screen_rect(WidgetId Id) const -> Rect {
+    // Parents are always added before their children, so the walk ends
+    i32 Xoffset = 0;
+    i32 Yoffset = 0;
+    for (WidgetId parent = this->m_widgets[Id].parent; parent != k_no_widget;
+         parent = this->m_widgets[parent].parent) {
+        const Widget &widget = this->m_widgets[parent];
+        if (!widget.visible) return k_nowhere;
+        Xoffset += widget.box.Xstart;
+        Yoffset += widget.box.Ystart;
+    }
+
+    const Widget &widget = this->m_widgets[Id];
+    if (!widget.visible || widget.box.empty()) return k_nowhere;
+    return {static_cast<i16>(widget.box.Xstart + Xoffset),
+            static_cast<i16>(widget.box.Ystart + Yoffset),
+            static_cast<i16>(widget.box.Xend + Xoffset),
+            static_cast<i16>(widget.box.Yend + Yoffset)};
+}
+
+auto WidgetTree::draw_widget(Paint &paint, const Widget &widget, const Rect &Area) const
+    -> void {
+    switch (widget.kind) {
+        case eWidgetKind::LABEL:
+            paint.draw_text(Area,
+                            widget.text,
+                            *widget.font,
+                            widget.foreground,
+                            widget.background,
+                            widget.align);
+            break;
+        case eWidgetKind::NUMBER: {
+            const text::NumberText number = text::format_fixed(widget.value, widget.decimals);
+            paint.draw_text(Area,
+                            number.view(),
+                            *widget.font,
+                            widget.foreground,
+                            widget.background,
+                            eTextAlign::ALIGN_RIGHT);
+            break;
+        }
+        case eWidgetKind::BAR: {
+            paint.ClearWindows(
+                Area.Xstart, Area.Ystart, Area.Xend + 1, Area.Yend + 1, widget.background);
+            outline(paint, Area, widget.foreground);
+            // In 64 bits, the range of two i32 times the width does not fit 32
+            const i64 inner = std::max<i32>(Area.width() - 2, 0);
+            const i64 range = static_cast<i64>(widget.max) - widget.min;
+            const i64 above = static_cast<i64>(std::clamp(widget.value, widget.min, widget.max)) -
+                              widget.min;
+            const i32 filled = range == 0 ? 0 : static_cast<i32>(above * inner / range);
+            paint.ClearWindows(Area.Xstart + 1,
+                               Area.Ystart + 1,
+                               Area.Xstart + 1 + filled,
+                               Area.Yend,
+                               widget.foreground);
+            break;
+        }
+        case eWidgetKind::ICON:
+            paint.draw_mask(widget.src,
+                            widget.src_stride,
+                            Area.Xstart,
+                            Area.Ystart,
+                            static_cast<u16>(Area.width()),
+                            static_cast<u16>(Area.height()),
+                            widget.foreground,
+                            widget.background);
+            break;
+        case eWidgetKind::RECTANGLE:
+            if (widget.filled) {
+                paint.ClearWindows(
+                    Area.Xstart, Area.Ystart, Area.Xend + 1, Area.Yend + 1, widget.foreground);
+            } else {
+                outline(paint, Area, widget.foreground);
+            }
+            break;
+    }
+}
+
+auto WidgetTree::render(Paint &paint, DirtyRects &Dirty) -> bool {
+    // Everything that looks different now: where changed widgets are and where they were
+    DirtyRects damage;
+    if (this->m_whole) damage.add(paint.get_clip());
+    for (WidgetId id = 0; id < this->m_count; id++) {
+        Widget &widget = this->m_widgets[id];
+        const Rect now = this->screen_rect(id);
+        if (widget.changed || now != widget.drawn) {
+            damage.add(widget.drawn);
+            damage.add(now);
+        }
+        widget.drawn = now;
+        widget.changed = false;
+    }
+    this->m_whole = false;
+    if (damage.empty()) return false;
+
+    // Each area is cleared and drawn again from the bottom widget up, so areas merged into
+    // overlapping ones still come out right
+    for (const Rect &area : damage) {
+        if (!paint.push_clip(area)) continue;
+        paint.ClearWindows(
+            area.Xstart, area.Ystart, area.Xend + 1, area.Yend + 1, this->m_background);
+        for (WidgetId id = 0; id < this->m_count; id++) {
+            const Widget &widget = this->m_widgets[id];
+            if (!widget.drawn.intersect(area).empty()) {
+                this->draw_widget(paint, widget, widget.drawn);
+            }
+        }
+        Dirty.add(paint.get_clip());
+        paint.pop_clip();
+    }
+    return true;
+}
+
+auto WidgetTree::invalidate() -> void { this->m_whole = true; }
+
+auto WidgetTree::bounds(WidgetId Id) const -> Rect {
+    return this->valid(Id) ? this->screen_rect(Id) : k_nowhere;
+}
@@ -0,0 +1,255 @@
+#!/usr/bin/env python3
+"""Packs one of the fixed-cell font tables in src/ into a bit-packed font.
+
+Every glyph is cropped to its ink box and the remaining pixels are stored as one
+MSB-first bit stream, starting on a byte boundary. Blank glyphs take no bytes at
+all. The output is a C++ source defining a `pico_oled::font::PackedFont`, see
+includes/pico-oled/packed_font.hpp for the decoder.
+
+With --chars and/or --scan only the glyphs of those characters (and the fallback
+glyph) are kept, indexed by a sorted list of their codes. A character the font
+has no glyph for is an error, so a subset built by CMake fails the build instead
+of drawing '?' at runtime.
+
+usage: pack_font.py src/font24.cpp --name Font24Packed -o src/font24_packed.cpp
+       pack_font.py src/font24.cpp --name Clock24 --chars "0123456789:" -o clock24.cpp
+       pack_font.py src/font12.cpp --name Ui12 --scan src/ui.cpp -o ui12.cpp --header ui12.hpp
+"""
+
+import argparse
+import re
+import sys
+
+FIRST_CHAR = 0x20
+GLYPH_COUNT = 95
+FALLBACK_CHAR = "?"
+BYTES_PER_LINE = 12
+
+
+def parse_font(path):
+    """Returns (table bytes, width, height) of the font defined in `path`."""
+    with open(path, encoding="utf-8") as f:
+        source = f.read()
+
+    table = re.search(r"static constexpr uint8_t \w+\[\] = \{(.*?)\n\};", source, re.S)
+    width = re.search(r"\.Width = (\d+),", source)
+    height = re.search(r"\.Height = (\d+),", source)
+    if not (table and width and height):
+        sys.exit(f"{path}: no font table found")
+
+    body = re.sub(r"//[^\n]*", "", table.group(1))
+    data = [int(value, 16) for value in re.findall(r"0[xX][0-9a-fA-F]+", body)]
+    return data, int(width.group(1)), int(height.group(1))
+
+
+def glyph_pixels(data, width, height, glyph):
+    """Rows of booleans of one glyph."""
+    stride = (width + 7) // 8
+    base = glyph * height * stride
+    return [
+        [bool(data[base + row * stride + column // 8] & (0x80 >> (column % 8))) for column in range(width)]
+        for row in range(height)
+    ]
+
+
+def ink_box(pixels, width, height):
+    """(top, bottom, left, right) of the set pixels, the empty box of make_glyph_boxes if none."""
+    rows = [row for row in range(height) if any(pixels[row])]
+    columns = [column for column in range(width) if any(pixels[row][column] for row in range(height))]
+    if not rows:
+        return height, 0, width, 0
+    return rows[0], rows[-1], columns[0], columns[-1]
+
+
+def pack_glyph(pixels, box):
+    """Bit stream of the pixels within `box`, padded to whole bytes."""
+    top, bottom, left, right = box
+    if top > bottom:
+        return []
+    out = []
+    bit = 0
+    for row in range(top, bottom + 1):
+        for column in range(left, right + 1):
+            if bit % 8 == 0:
+                out.append(0)
+            if pixels[row][column]:
+                out[-1] |= 0x80 >> (bit % 8)
+            bit += 1
+    return out
+
+
+ESCAPES = {"n": "\n", "r": "\r", "t": "\t", "0": "\0"}
+
+
+def unescape(literal):
+    """Decodes the escape sequences of a C++ string literal body."""
+
+    def replace(match):
+        escape = match.group(1)
+        if escape[0] == "x":
+            return chr(int(escape[1:], 16))
+        return ESCAPES.get(escape, escape)
+
+    return re.sub(r"\\(x[0-9a-fA-F]{1,2}|.)", replace, literal)
+
+
+def string_literals(path):
+    """Yields (line, text) of every string literal in a C++ source."""
+    token = re.compile(r'//.*|"(?:[^"\\\n]|\\.)*"|\'(?:[^\'\\\n]|\\.)*\'')
+    with open(path, encoding="utf-8") as f:
+        for number, line in enumerate(f, 1):
+            if line.lstrip().startswith("#"):
+                continue
+            for match in token.finditer(line):
+                if match.group(0).startswith('"'):
+                    yield number, unescape(match.group(0)[1:-1])
+
+
+def wanted_chars(chars, scans):
+    """Maps every requested character to where it was asked for."""
+    wanted = {}
+    for char in chars or "":
+        wanted.setdefault(char, "--chars")
+    for path in scans or []:
+        for line, text in string_literals(path):
+            for char in text:
+                # Line breaks and the like are layout, not glyphs
+                if ord(char) >= FIRST_CHAR:
+                    wanted.setdefault(char, f"{path}:{line}")
+    return wanted
+
+
+def emit(name, source, width, height, glyphs, sparse):
+    """C++ source of the packed font, `glyphs` holds (char, box, bytes) for every glyph."""
+    symbol = re.sub(r"\W", "_", name)
+    offsets = []
+    data_lines = []
+    offset = 0
+    for char, box, packed in glyphs:
+        offsets.append(offset)
+        offset += len(packed)
+        if packed:
+            data_lines.append(f"    // @{offsets[-1]} {char!r}")
+            for start in range(0, len(packed), BYTES_PER_LINE):
+                chunk = packed[start : start + BYTES_PER_LINE]
+                data_lines.append("    " + " ".join(f"0x{value:02X}," for value in chunk))
+
+    if not data_lines:
+        # C++ has no empty arrays, a font of blank glyphs still gets a byte
+        data_lines.append("    0x00,")
+
+    codes = []
+    if sparse:
+        codes = [
+            "",
+            f"static constexpr u8 {symbol}_Codes[] = {{",
+            *(f"    0x{ord(char):02X},  // {char!r}" for char, _, _ in glyphs),
+            "};",
+        ]
+    fallback = next(index for index, (char, _, _) in enumerate(glyphs) if char == FALLBACK_CHAR)
+
+    lines = [
+        f"// Generated by tools/pack_font.py from {source}, do not edit.",
+        "",
+        '#include "packed_font.hpp"',
+        "",
+        "namespace pico_oled::font {",
+        "",
+        f"static constexpr u8 {symbol}_Data[] = {{",
+        *data_lines,
+        "};",
+        "",
+        f"static constexpr u16 {symbol}_Offsets[] = {{",
+        *(f"    {value}," for value in offsets),
+        "};",
+        "",
+        f"static constexpr GlyphBox {symbol}_Boxes[] = {{",
+        *(f"    {{{box[0]}, {box[1]}, {box[2]}, {box[3]}}},  // {char!r}" for char, box, _ in glyphs),
+        "};",
+        *codes,
+        "",
+        "// Declared extern first, a constexpr variable alone has internal linkage",
+        f"extern const PackedFont {name};",
+        f"constexpr PackedFont {name} = {{",
+        f"    .data = {symbol}_Data,",
+        f"    .Width = {width},",
+        f"    .Height = {height},",
+        f"    .Stride = ({width} + 7) / 8,",
+        f"    .Count = {len(glyphs)},",
+        f"    .codes = {symbol + '_Codes' if sparse else 'nullptr'},",
+        f"    .offsets = {symbol}_Offsets,",
+        f"    .boxes = {symbol}_Boxes,",
+        f"    .Fallback = {fallback},",
+        "};",
+        "",
+        "}  // namespace pico_oled::font",
+        "",
+    ]
+    return "\n".join(lines), offset
+
+
+def emit_header(name):
+    """Header declaring the packed font `name`."""
+    guard = "__PICO_OLED_FONT_" + re.sub(r"\W", "_", name).upper() + "_HPP"
+    return "\n".join(
+        [
+            "// Generated by tools/pack_font.py, do not edit.",
+            "",
+            f"#ifndef {guard}",
+            f"#define {guard}",
+            "",
+            '#include "packed_font.hpp"',
+            "",
+            "namespace pico_oled::font {",
+            f"extern const PackedFont {name};",
+            "}",
+            "",
+            "#endif",
+            "",
+        ]
+    )
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("font", help="font source, e.g. src/font24.cpp")
+    parser.add_argument("--name", required=True, help="name of the PackedFont variable")
+    parser.add_argument("-o", "--output", required=True, help="generated C++ source")
+    parser.add_argument("--header", help="also write a header declaring the font")
+    parser.add_argument("--chars", help="keep only these characters")
+    parser.add_argument("--scan", action="append", help="keep the characters of the string literals in this source")
+    args = parser.parse_args()
+
+    data, width, height = parse_font(args.font)
+    if len(data) != GLYPH_COUNT * height * ((width + 7) // 8):
+        sys.exit(f"{args.font}: expected {GLYPH_COUNT} glyphs of {width}x{height}")
+
+    available = [chr(FIRST_CHAR + glyph) for glyph in range(GLYPH_COUNT)]
+    sparse = args.chars is not None or args.scan is not None
+    if sparse:
+        wanted = wanted_chars(args.chars, args.scan)
+        missing = sorted(char for char in wanted if char not in available)
+        for char in missing:
+            print(f"{wanted[char]}: error: {args.font} has no glyph for {char!r} (U+{ord(char):04X})", file=sys.stderr)
+        if missing:
+            sys.exit(1)
+        wanted[FALLBACK_CHAR] = "fallback"
+        available = sorted(wanted)
+
+    glyphs = []
+    for char in available:
+        pixels = glyph_pixels(data, width, height, ord(char) - FIRST_CHAR)
+        box = ink_box(pixels, width, height)
+        glyphs.append((char, box, pack_glyph(pixels, box)))
+
+    text, packed_size = emit(args.name, args.font.replace("\\", "/"), width, height, glyphs, sparse)
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(text)
+    if args.header:
+        with open(args.header, "w", encoding="utf-8") as f:
+            f.write(emit_header(args.name))
+    print(f"{args.name}: {len(glyphs)} glyphs, {len(data)} -> {packed_size} bytes of glyph data")
+
+
+if __name__ == "__main__":
+    main()